@@ -0,0 +1,70 @@
+#ifndef BENCH_CLOCK_H
+#define BENCH_CLOCK_H
+
+#include <Arduino.h>
+
+/**
+ * @brief The finest timestamp each board offers: the core cycle counter on
+ * ESP32/ESP8266 (ESP.getCycleCount()) and on Cortex-M3/M4/M7/M33 (DWT
+ * CYCCNT), micros() elsewhere (AVR, Cortex-M0+).
+ */
+#if defined(ESP32) || defined(ESP8266)
+#define BENCH_CLOCK_ESP 1
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+#define BENCH_CLOCK_DWT 1
+#endif
+
+struct BenchClock {
+#if defined(BENCH_CLOCK_DWT)
+  // Debug registers by address, so no CMSIS device header is needed.
+  static volatile uint32_t& demcr() { return *reinterpret_cast<volatile uint32_t*>(0xE000EDFCUL); }
+  static volatile uint32_t& dwtCtrl() { return *reinterpret_cast<volatile uint32_t*>(0xE0001000UL); }
+  static volatile uint32_t& dwtCyccnt() { return *reinterpret_cast<volatile uint32_t*>(0xE0001004UL); }
+  static volatile uint32_t& dwtLar() { return *reinterpret_cast<volatile uint32_t*>(0xE0001FB0UL); }
+#endif
+
+  /** @brief Starts the counter (the DWT one is off after reset). */
+  static void begin() {
+#if defined(BENCH_CLOCK_DWT)
+    demcr() |= 1UL << 24;   // TRCENA
+    dwtLar() = 0xC5ACCE55UL; // unlock (Cortex-M7; ignored elsewhere)
+    dwtCyccnt() = 0;
+    dwtCtrl() |= 1UL;       // CYCCNTENA
+#endif
+  }
+
+  /** @brief Current timestamp in ticks (wraps; subtract as uint32_t). */
+  static uint32_t now() {
+#if defined(BENCH_CLOCK_ESP)
+    return ESP.getCycleCount();
+#elif defined(BENCH_CLOCK_DWT)
+    return dwtCyccnt();
+#else
+    return micros();
+#endif
+  }
+
+  /** @brief Ticks per second. */
+  static uint32_t hz() {
+#if defined(BENCH_CLOCK_ESP)
+    return (uint32_t)ESP.getCpuFreqMHz() * 1000000UL;
+#elif defined(BENCH_CLOCK_DWT) && defined(F_CPU)
+    return F_CPU;
+#elif defined(BENCH_CLOCK_DWT)
+    return SystemCoreClock;
+#else
+    return 1000000UL;
+#endif
+  }
+
+  /** @brief What a tick is, for the report. */
+  static const char* unit() {
+#if defined(BENCH_CLOCK_ESP) || defined(BENCH_CLOCK_DWT)
+    return "cycles";
+#else
+    return "us";
+#endif
+  }
+};
+
+#endif
@@ -0,0 +1,167 @@
+/*
+ * Micro-benchmarks for the core View operations over typical payloads.
+ *
+ * Each operation is repeated, doubling the count until one batch takes at
+ * least 100 ms, and reported as one CSV line:
+ *
+ *   name,ops_per_sec,ticks_per_op,unit
+ *
+ * Ticks are CPU cycles where the board has a cycle counter (ESP32, ESP8266,
+ * Cortex-M3 and up) and microseconds otherwise (AVR, Cortex-M0+). The cost of
+ * the empty benchmark loop is measured first and subtracted. Inputs are read
+ * through volatile pointers so the compiler cannot hoist the work out of the
+ * loop. Keep the output of a release to compare later builds against; the
+ * flash and RAM used by the whole sketch are printed by arduino-cli compile
+ * and, where the board can tell, at the top of the report.
+ */
+#include <Views.h>
+#include "BenchClock.h"
+
+static const char kHttp[] =
+  "GET /api/v1/sensors?id=42&fields=temp,hum HTTP/1.1\r\n"
+  "Host: 192.168.4.1\r\n"
+  "User-Agent: esp-http-client/1.0\r\n"
+  "Accept: application/json\r\n"
+  "Connection: keep-alive\r\n"
+  "Content-Length: 27\r\n"
+  "\r\n"
+  "{\"temp\":23.45,\"hum\":48.2}";
+static const char kCsv[] = "1699999999,23.45,48.2,1013.25,-71,3.71,OK,7,12,0.002";
+static const char kPadded[] = "   sensor-node-07   \r\n";
+static const char kInteger[] = "-1234567";
+static const char kDecimal[] = "-12.345678";
+static const char kIdA[] = "urn:dev:mac:0024befffe804ff1/t01";
+static char kIdB[sizeof(kIdA)];
+static uint16_t kPacket[32];
+
+// Reloaded on every iteration, so no benchmark can be computed just once.
+static const char* volatile gHttp = kHttp;
+static const char* volatile gCsv = kCsv;
+static const char* volatile gPadded = kPadded;
+static const char* volatile gInteger = kInteger;
+static const char* volatile gDecimal = kDecimal;
+static const char* volatile gIdA = kIdA;
+static const char* volatile gIdB = kIdB;
+static const uint16_t* volatile gPacket = kPacket;
+
+volatile uint32_t benchSink;
+
+static const uint32_t kMinMillis = 100;
+static uint32_t gLoopTicks = 0; // per 1024 iterations of the empty loop
+
+/** @brief Ticks for n calls of op. */
+template<typename F>
+uint32_t timeBatch(F op, uint32_t n) {
+  uint32_t t0 = BenchClock::now();
+  for (uint32_t i = 0; i < n; i++) op();
+  return BenchClock::now() - t0;
+}
+
+/** @brief Calls op until a batch lasts kMinMillis, returning the batch size and its ticks. */
+template<typename F>
+uint32_t calibrate(F op, uint32_t& ticks) {
+  const uint32_t minTicks = BenchClock::hz() / 1000UL * kMinMillis;
+  uint32_t n = 16;
+  for (;;) {
+    ticks = timeBatch(op, n);
+    if (ticks >= minTicks || n >= (1UL << 26)) return n;
+    n *= 2;
+  }
+}
+
+template<typename F>
+void bench(const char* name, F op) {
+  uint32_t ticks;
+  uint32_t n = calibrate(op, ticks);
+  float overhead = (float)gLoopTicks * n / 1024.0f;
+  float perOp = ((float)ticks > overhead ? (float)ticks - overhead : 0.0f) / n;
+  Serial.print(name);
+  Serial.print(',');
+  Serial.print(perOp > 0 ? (float)BenchClock::hz() / perOp : 0.0f, 0);
+  Serial.print(',');
+  Serial.print(perOp, 3);
+  Serial.print(',');
+  Serial.println(BenchClock::unit());
+}
+
+static void printFootprint() {
+  Serial.print(F("# sizeof StringView/MemoryView<uint8_t>/Searcher<char>: "));
+  Serial.print((unsigned)sizeof(StringView));
+  Serial.print('/');
+  Serial.print((unsigned)sizeof(MemoryView<uint8_t>));
+  Serial.print('/');
+  Serial.println((unsigned)sizeof(Searcher<char>));
+#if defined(__AVR__)
+  extern char __data_load_end;
+  extern char __heap_start;
+  extern char* __brkval;
+  char top;
+  Serial.print(F("# flash used: "));
+  Serial.println((unsigned long)(uintptr_t)&__data_load_end);
+  Serial.print(F("# free RAM: "));
+  Serial.println((unsigned)(&top - (__brkval ? __brkval : &__heap_start)));
+#elif defined(ESP32) || defined(ESP8266)
+  Serial.print(F("# flash used: "));
+  Serial.println((unsigned long)ESP.getSketchSize());
+  Serial.print(F("# free heap: "));
+  Serial.println((unsigned long)ESP.getFreeHeap());
+#endif
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+
+  memcpy(kIdB, kIdA, sizeof(kIdA));
+  for (size_t i = 0; i < 32; i++) kPacket[i] = (uint16_t)(i * 977u);
+  BenchClock::begin();
+  gLoopTicks = timeBatch([] { benchSink = 0; }, 1024);
+
+  printFootprint();
+  Serial.println(F("name,ops_per_sec,ticks_per_op,unit"));
+
+  bench("indexOf(char)", [] {
+    StringView http(gHttp, sizeof(kHttp) - 1);
+    benchSink = (uint32_t)http.indexOf('{');
+  });
+  bench("indexOf(\"\\r\\n\\r\\n\")", [] {
+    StringView http(gHttp, sizeof(kHttp) - 1);
+    benchSink = (uint32_t)http.indexOf("\r\n\r\n");
+  });
+  bench("contains(\"keep-alive\")", [] {
+    StringView http(gHttp, sizeof(kHttp) - 1);
+    benchSink = http.contains("keep-alive");
+  });
+  bench("nextToken(',') x10", [] {
+    StringView csv(gCsv, sizeof(kCsv) - 1);
+    size_t offset = 0;
+    uint32_t total = 0;
+    while (offset < csv.length()) total += csv.nextToken(',', offset).length();
+    benchSink = total;
+  });
+  bench("toLong", [] {
+    StringView s(gInteger, sizeof(kInteger) - 1);
+    benchSink = (uint32_t)s.toLong();
+  });
+  bench("toDouble", [] {
+    StringView s(gDecimal, sizeof(kDecimal) - 1);
+    benchSink = (uint32_t)(int32_t)(s.toDouble() * 1000.0);
+  });
+  bench("equals(32 bytes)", [] {
+    benchSink = StringView(gIdA, sizeof(kIdA) - 1) == StringView(gIdB, sizeof(kIdA) - 1);
+  });
+  bench("trim", [] {
+    benchSink = StringView(gPadded, sizeof(kPadded) - 1).trim().length();
+  });
+  bench("castTo<uint16_t> sum x32", [] {
+    MemoryView<uint8_t> bytes(reinterpret_cast<const uint8_t*>(gPacket), sizeof(kPacket));
+    MemoryView<uint16_t> words = bytes.castTo<uint16_t>();
+    uint32_t total = 0;
+    for (size_t i = 0; i < words.length(); i++) total += words[i];
+    benchSink = total;
+  });
+
+  Serial.println(F("# done"));
+}
+
+void loop() {}
@@ -0,0 +1,165 @@
+// Google Benchmark comparisons of the view operations against the C++17
+// standard library on the same payloads: string_view::find for searching and
+// tokenizing, from_chars for number parsing. Build with
+// -DVIEWS_BUILD_BENCHMARKS=ON (needs an installed Google Benchmark) and run
+// build/views_host_benchmarks. Each loop passes its input through
+// DoNotOptimize so a search cannot be hoisted out of the timing loop.
+#include <benchmark/benchmark.h>
+
+#include <charconv>
+#include <string>
+#include <string_view>
+
+#include <Views.h>
+
+namespace {
+
+const std::string& httpRequest() {
+  static const std::string s = [] {
+    std::string r = "POST /api/v1/telemetry?device=node-07&fw=1.4.2 HTTP/1.1\r\n"
+                    "Host: collector.local\r\nUser-Agent: esp-http-client/1.0\r\n"
+                    "Accept: application/json\r\nConnection: keep-alive\r\n";
+    for (int i = 0; i < 40; i++) r += "X-Trace-" + std::to_string(i) + ": 0123456789abcdef\r\n";
+    return r + "Content-Length: 27\r\n\r\n{\"temp\":23.45,\"hum\":48.2}";
+  }();
+  return s;
+}
+
+const std::string kCsv = "1699999999,23.45,48.2,1013.25,-71,3.71,OK,7,12,0.002,17,-3,998,4.5e-3,1";
+
+void BM_View_IndexOfChar(benchmark::State& state) {
+  StringView v(httpRequest().data(), httpRequest().size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(v);
+    benchmark::DoNotOptimize(v.indexOf('{'));
+  }
+  state.SetBytesProcessed(state.iterations() * (int64_t)httpRequest().size());
+}
+
+void BM_Std_FindChar(benchmark::State& state) {
+  std::string_view v(httpRequest());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(v);
+    benchmark::DoNotOptimize(v.find('{'));
+  }
+  state.SetBytesProcessed(state.iterations() * (int64_t)httpRequest().size());
+}
+
+void BM_View_IndexOfPattern(benchmark::State& state) {
+  StringView v(httpRequest().data(), httpRequest().size());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(v);
+    benchmark::DoNotOptimize(v.indexOf("\r\n\r\n"));
+  }
+  state.SetBytesProcessed(state.iterations() * (int64_t)httpRequest().size());
+}
+
+void BM_View_SearcherPattern(benchmark::State& state) {
+  StringView v(httpRequest().data(), httpRequest().size());
+  Searcher<char> blankLine("\r\n\r\n");
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(v);
+    benchmark::DoNotOptimize(v.indexOf(blankLine));
+  }
+  state.SetBytesProcessed(state.iterations() * (int64_t)httpRequest().size());
+}
+
+void BM_Std_FindPattern(benchmark::State& state) {
+  std::string_view v(httpRequest());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(v);
+    benchmark::DoNotOptimize(v.find("\r\n\r\n"));
+  }
+  state.SetBytesProcessed(state.iterations() * (int64_t)httpRequest().size());
+}
+
+void BM_View_NextToken(benchmark::State& state) {
+  StringView csv(kCsv.data(), kCsv.size());
+  for (auto _ : state) {
+    size_t offset = 0, total = 0;
+    while (offset < csv.length()) total += csv.nextToken(',', offset).length();
+    benchmark::DoNotOptimize(total);
+  }
+}
+
+void BM_Std_SplitFind(benchmark::State& state) {
+  std::string_view csv(kCsv);
+  for (auto _ : state) {
+    size_t offset = 0, total = 0;
+    while (offset < csv.size()) {
+      size_t pos = csv.find(',', offset);
+      if (pos == std::string_view::npos) pos = csv.size();
+      total += pos - offset;
+      offset = pos + 1;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+}
+
+const char* const kIntegers[] = {"0", "-71", "1013", "1699999999", "-2147483648", "42", "998", "7"};
+
+void BM_View_ParseInt(benchmark::State& state) {
+  for (auto _ : state)
+    for (const char* s : kIntegers) benchmark::DoNotOptimize(StringView(s).parseInt<long>().value);
+}
+
+void BM_Std_FromCharsInt(benchmark::State& state) {
+  for (auto _ : state)
+    for (const char* s : kIntegers) {
+      long v = 0;
+      std::from_chars(s, s + strlen(s), v);
+      benchmark::DoNotOptimize(v);
+    }
+}
+
+void BM_Libc_Strtol(benchmark::State& state) {
+  for (auto _ : state)
+    for (const char* s : kIntegers) benchmark::DoNotOptimize(strtol(s, nullptr, 10));
+}
+
+const char* const kDecimals[] = {"23.45", "-12.345678", "1013.25", "3.71", "0.002", "4.5e-3", "-0.5", "180.0"};
+
+void BM_View_ParseFloat(benchmark::State& state) {
+  for (auto _ : state)
+    for (const char* s : kDecimals) benchmark::DoNotOptimize(StringView(s).parseFloat<double>().value);
+}
+
+void BM_View_ParseFixedPoint(benchmark::State& state) {
+  for (auto _ : state)
+    for (const char* s : kDecimals) benchmark::DoNotOptimize(StringView(s).parseFixedPoint(3).value);
+}
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+void BM_Std_FromCharsDouble(benchmark::State& state) {
+  for (auto _ : state)
+    for (const char* s : kDecimals) {
+      double v = 0;
+      std::from_chars(s, s + strlen(s), v);
+      benchmark::DoNotOptimize(v);
+    }
+}
+BENCHMARK(BM_Std_FromCharsDouble);
+#endif
+
+void BM_Libc_Strtod(benchmark::State& state) {
+  for (auto _ : state)
+    for (const char* s : kDecimals) benchmark::DoNotOptimize(strtod(s, nullptr));
+}
+
+} // namespace
+
+BENCHMARK(BM_View_IndexOfChar);
+BENCHMARK(BM_Std_FindChar);
+BENCHMARK(BM_View_IndexOfPattern);
+BENCHMARK(BM_View_SearcherPattern);
+BENCHMARK(BM_Std_FindPattern);
+BENCHMARK(BM_View_NextToken);
+BENCHMARK(BM_Std_SplitFind);
+BENCHMARK(BM_View_ParseInt);
+BENCHMARK(BM_Std_FromCharsInt);
+BENCHMARK(BM_Libc_Strtol);
+BENCHMARK(BM_View_ParseFloat);
+BENCHMARK(BM_View_ParseFixedPoint);
+BENCHMARK(BM_Libc_Strtod);
+
+BENCHMARK_MAIN();
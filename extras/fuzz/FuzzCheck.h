@@ -0,0 +1,61 @@
+#ifndef VIEWS_FUZZ_CHECK_H
+#define VIEWS_FUZZ_CHECK_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <string>
+
+#include <Views.h>
+
+/** @brief Aborts (so libFuzzer saves the input) when an invariant does not hold. */
+#define FUZZ_CHECK(cond)                                                     \
+  do {                                                                       \
+    if (!(cond)) {                                                           \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+      abort();                                                               \
+    }                                                                        \
+  } while (0)
+
+/**
+ * @brief Splits a fuzz input into leading parameter bytes and the rest.
+ * The text is copied into its own allocation so ASan catches any read past
+ * the end of the view.
+ */
+struct FuzzInput {
+  FuzzInput(const uint8_t* data, size_t size) : _data(data), _size(size) {}
+
+  /** @brief The next parameter byte, or 0 once the input is used up. */
+  uint8_t byte() {
+    if (_size == 0) return 0;
+    _size--;
+    return *_data++;
+  }
+
+  /** @brief Up to max bytes as a string. */
+  std::string take(size_t max) {
+    size_t n = max < _size ? max : _size;
+    std::string s(reinterpret_cast<const char*>(_data), n);
+    _data += n;
+    _size -= n;
+    return s;
+  }
+
+  /** @brief Everything that is left. */
+  std::string rest() { return take(_size); }
+
+private:
+  const uint8_t* _data;
+  size_t _size;
+};
+
+/** @brief A StringView over s (a null view when s is empty, as buffers often are). */
+inline StringView viewOf(const std::string& s) {
+  return s.empty() ? StringView() : StringView(s.data(), s.size());
+}
+
+inline bool sameText(const StringView& v, const std::string& s) {
+  return v.length() == s.size() && (s.empty() || memcmp(v.data(), s.data(), s.size()) == 0);
+}
+
+#endif
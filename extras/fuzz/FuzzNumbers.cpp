@@ -0,0 +1,74 @@
+// parseInt / parseUnsigned / parseHex / toLong checked against the C library
+// (strtol family), parseFloat and parseFixedPoint against strtod within a
+// tolerance.
+#include <errno.h>
+#include <math.h>
+
+#include "FuzzCheck.h"
+
+namespace {
+
+bool isSpaceOrSign(char c) { return isspace((unsigned char)c) || c == '+' || c == '-'; }
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  FuzzInput in(data, size);
+  std::string text = in.take(48);
+  StringView view = viewOf(text);
+  const char* s = text.c_str();
+  char* end;
+
+  // Every parse stays inside the view.
+  ParseResult<long> i = view.parseInt<long>();
+  ParseResult<unsigned long> u = view.parseUnsigned<unsigned long>();
+  ParseResult<uint32_t> h = view.parseHex<uint32_t>();
+  ParseResult<int16_t> small = view.parseInt<int16_t>();
+  ParseResult<double> f = view.parseFloat<double>();
+  ParseResult<int32_t> fixed = view.parseFixedPoint(3, true);
+  FUZZ_CHECK(i.consumed <= text.size() && u.consumed <= text.size() && h.consumed <= text.size());
+  FUZZ_CHECK(small.consumed <= text.size() && f.consumed <= text.size() && fixed.consumed <= text.size());
+  FUZZ_CHECK((i.status == ParseStatus::NoDigits) == (i.consumed == 0));
+
+  // C strings end at a NUL; compare only on the text before it.
+  if (memchr(text.data(), '\0', text.size())) return 0;
+
+  if (text.empty() || !isspace((unsigned char)text[0])) {
+    errno = 0;
+    long want = strtol(s, &end, 10);
+    FUZZ_CHECK(i.consumed == (size_t)(end - s));
+    if (i.consumed) {
+      FUZZ_CHECK(i.value == want);
+      FUZZ_CHECK((i.status == ParseStatus::Overflow) == (errno == ERANGE));
+    }
+    if (small.ok()) FUZZ_CHECK(small.value == want);
+  }
+  errno = 0;
+  long viaToLong = strtol(s, &end, 10);
+  FUZZ_CHECK(view.toLong() == (end == s ? 0 : viaToLong));
+
+  if (text.empty() || (!isSpaceOrSign(text[0]))) {
+    errno = 0;
+    unsigned long want = strtoul(s, &end, 10);
+    FUZZ_CHECK(u.consumed == (size_t)(end - s));
+    if (u.consumed) FUZZ_CHECK(u.value == want && u.ok() == (errno != ERANGE));
+
+    errno = 0;
+    unsigned long wantHex = strtoul(s, &end, 16);
+    FUZZ_CHECK(h.consumed == (size_t)(end - s));
+    if (h.ok()) FUZZ_CHECK(h.value == wantHex);
+  }
+
+  // Decimal floats: same span as strtod where the text has no hex, inf or
+  // nan forms (which this parser deliberately does not accept), and a value
+  // within a few ulps.
+  if (f.ok() && text.find_first_of("xXiInN") == std::string::npos &&
+      (text.empty() || !isspace((unsigned char)text[0]))) {
+    double want = strtod(s, &end);
+    FUZZ_CHECK(f.consumed == (size_t)(end - s));
+    if (want != 0 && fabs(want) > 1e-300 && fabs(want) < 1e300)
+      FUZZ_CHECK(fabs(f.value - want) <= 1e-12 * fabs(want));
+    if (fixed.ok() && fabs(want) < 2e6) FUZZ_CHECK(fabs(fixed.value / 1000.0 - want) <= 0.0005 + 1e-9);
+  }
+  return 0;
+}
@@ -0,0 +1,44 @@
+// indexOf / lastIndexOf / Searcher / indexOfIgnoreCase checked against
+// std::string and a naive case-folding search.
+#include <ctype.h>
+
+#include "FuzzCheck.h"
+
+namespace {
+
+int toInt(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+
+int naiveFindFolded(const std::string& text, const std::string& pattern, size_t from) {
+  for (size_t i = from; i + pattern.size() <= text.size(); i++) {
+    size_t k = 0;
+    while (k < pattern.size() && tolower((unsigned char)text[i + k]) == tolower((unsigned char)pattern[k])) k++;
+    if (k == pattern.size()) return (int)i;
+  }
+  return -1;
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  FuzzInput in(data, size);
+  char value = (char)in.byte();
+  size_t from = in.byte();
+  std::string pattern = in.take(in.byte() % 24);
+  std::string text = in.rest();
+  StringView view = viewOf(text);
+
+  FUZZ_CHECK(view.indexOf(value, from) == (from >= text.size() ? -1 : toInt(text.find(value, from))));
+  FUZZ_CHECK(view.indexOf(value) == toInt(text.find(value)));
+  FUZZ_CHECK(view.lastIndexOf(value) == toInt(text.rfind(value)));
+  FUZZ_CHECK(view.lastIndexOf(value, from) == toInt(text.rfind(value, from)));
+
+  if (!pattern.empty() && from <= text.size()) {
+    int want = toInt(text.find(pattern, from));
+    FUZZ_CHECK(view.indexOf(viewOf(pattern), from) == want);
+    Searcher<char> searcher(viewOf(pattern));
+    FUZZ_CHECK(view.indexOf(searcher, from) == want);
+    FUZZ_CHECK(view.contains(viewOf(pattern)) == (text.find(pattern) != std::string::npos));
+    FUZZ_CHECK(view.indexOfIgnoreCase(viewOf(pattern), from) == naiveFindFolded(text, pattern, from));
+  }
+  return 0;
+}
@@ -0,0 +1,69 @@
+// nextToken over char, string, Searcher and DelimiterSet delimiters, checked
+// against std::string::find / find_first_of.
+#include "FuzzCheck.h"
+
+namespace {
+
+/** @brief The token sequence nextToken should produce, from std::string. */
+template<typename FindFn>
+std::string expectToken(const std::string& text, size_t& offset, size_t delimLen, FindFn find) {
+  size_t pos = find(offset);
+  if (pos == std::string::npos) {
+    std::string token = text.substr(offset);
+    offset = text.size();
+    return token;
+  }
+  std::string token = text.substr(offset, pos - offset);
+  offset = pos + delimLen;
+  return token;
+}
+
+} // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  FuzzInput in(data, size);
+  char delim = (char)in.byte();
+  std::string pattern = in.take(in.byte() % 5);
+  std::string set = in.take(in.byte() % 4);
+  std::string text = in.rest();
+  StringView view = viewOf(text);
+
+  // Single character.
+  size_t a = 0, b = 0;
+  while (a < text.size()) {
+    StringView got = view.nextToken(delim, a);
+    std::string want = expectToken(text, b, 1, [&](size_t from) { return text.find(delim, from); });
+    FUZZ_CHECK(sameText(got, want));
+    FUZZ_CHECK(a == b);
+  }
+
+  // Multi-character pattern, plain and precomputed.
+  if (!pattern.empty()) {
+    Searcher<char> searcher(viewOf(pattern));
+    size_t c = 0;
+    a = b = 0;
+    while (a < text.size()) {
+      StringView got = view.nextToken(viewOf(pattern), a);
+      StringView viaSearcher = view.nextToken(searcher, c);
+      std::string want =
+        expectToken(text, b, pattern.size(), [&](size_t from) { return text.find(pattern, from); });
+      FUZZ_CHECK(sameText(got, want));
+      FUZZ_CHECK(sameText(viaSearcher, want));
+      FUZZ_CHECK(a == b && c == b);
+    }
+  }
+
+  // Any member of a set. DelimiterSet(const char*) stops at a NUL.
+  std::string members = set.substr(0, set.find('\0'));
+  DelimiterSet delims(members.c_str());
+  a = b = 0;
+  while (a < text.size()) {
+    StringView got = view.nextToken(delims, a);
+    std::string want = expectToken(text, b, 1, [&](size_t from) {
+      return members.empty() ? std::string::npos : text.find_first_of(members, from);
+    });
+    FUZZ_CHECK(sameText(got, want));
+    FUZZ_CHECK(a == b);
+  }
+  return 0;
+}
@@ -0,0 +1,107 @@
+// Driver for the fuzz harnesses where libFuzzer is not available (GCC, MSVC,
+// CI smoke runs). With file or directory arguments it replays them, e.g. a
+// saved crash or corpus; without, it runs -runs=N (default 200000) inputs
+// from a fixed-seed generator biased towards digits, signs, delimiters and
+// repeated fragments. An input that fails a check is saved to
+// crash-standalone for replay.
+#include <dirent.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+namespace {
+
+uint32_t gState = 2463534242u;
+const std::vector<uint8_t>* gCurrent = nullptr;
+
+void saveCurrent(int sig) {
+  if (gCurrent) {
+    if (FILE* f = fopen("crash-standalone", "wb")) {
+      fwrite(gCurrent->data(), 1, gCurrent->size(), f);
+      fclose(f);
+      fprintf(stderr, "failing input (%zu bytes) saved to crash-standalone\n", gCurrent->size());
+    }
+  }
+  signal(sig, SIG_DFL);
+  raise(sig);
+}
+
+uint32_t next() {
+  gState ^= gState << 13;
+  gState ^= gState >> 17;
+  gState ^= gState << 5;
+  return gState;
+}
+
+std::vector<uint8_t> generate() {
+  static const char kAlphabet[] = "0123456789+-.eE,; \t\r\nxXaAfF:/\"";
+  std::vector<uint8_t> input;
+  size_t len = next() % 96;
+  while (input.size() < len) {
+    uint32_t r = next();
+    switch (r % 8) {
+      case 0: input.push_back((uint8_t)(r >> 8)); break;                       // any byte
+      case 1:                                                                   // repeat a run
+        if (!input.empty()) {
+          size_t start = (r >> 8) % input.size(), n = (r >> 16) % 8;
+          for (size_t k = 0; k < n && start + k < input.size(); k++) input.push_back(input[start + k]);
+          break;
+        }
+        // fall through
+      default: input.push_back((uint8_t)kAlphabet[(r >> 8) % (sizeof(kAlphabet) - 1)]); break;
+    }
+  }
+  return input;
+}
+
+bool runFile(const std::string& path) {
+  FILE* f = fopen(path.c_str(), "rb");
+  if (!f) return false;
+  std::vector<uint8_t> data;
+  int c;
+  while ((c = fgetc(f)) != EOF) data.push_back((uint8_t)c);
+  fclose(f);
+  gCurrent = &data;
+  LLVMFuzzerTestOneInput(data.data(), data.size());
+  gCurrent = nullptr;
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  signal(SIGABRT, saveCurrent);
+  long runs = 200000;
+  bool replayed = false;
+  for (int a = 1; a < argc; a++) {
+    if (strncmp(argv[a], "-runs=", 6) == 0) {
+      runs = atol(argv[a] + 6);
+      continue;
+    }
+    if (DIR* dir = opendir(argv[a])) {
+      while (struct dirent* e = readdir(dir))
+        if (e->d_name[0] != '.') runFile(std::string(argv[a]) + "/" + e->d_name);
+      closedir(dir);
+    } else if (!runFile(argv[a])) {
+      fprintf(stderr, "cannot read %s\n", argv[a]);
+      return 2;
+    }
+    replayed = true;
+  }
+  if (!replayed) {
+    for (long i = 0; i < runs; i++) {
+      std::vector<uint8_t> input = generate();
+      gCurrent = &input;
+      LLVMFuzzerTestOneInput(input.data(), input.size());
+    }
+    printf("%ld inputs, no failures\n", runs);
+  }
+  return 0;
+}
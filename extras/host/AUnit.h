@@ -0,0 +1,85 @@
+#ifndef VIEWS_HOST_AUNIT_H
+#define VIEWS_HOST_AUNIT_H
+
+/*
+ * The subset of AUnit the test sketches use, so they run unchanged as host
+ * executables: test(suite, name) and assertEqual/NotEqual, assertTrue/False,
+ * assertLess/More(OrEqual) and assertNear. TestRunner::run() runs every test
+ * once, prints a summary and exits with the number of failed tests, which is
+ * what ctest checks.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace aunit {
+
+struct TestCase {
+  const char* name;
+  void (*body)(bool& ok);
+  TestCase* next;
+};
+
+inline TestCase*& testList() {
+  static TestCase* head = nullptr;
+  return head;
+}
+
+/** @brief Appends a test at static-initialisation time, keeping file order. */
+struct TestRegistration {
+  TestRegistration(TestCase& t) {
+    TestCase** p = &testList();
+    while (*p) p = &(*p)->next;
+    *p = &t;
+  }
+};
+
+inline void fail(bool& ok, const char* file, int line, const char* what) {
+  printf("  %s:%d: assertion failed: %s\n", file, line, what);
+  ok = false;
+}
+
+struct TestRunner {
+  static void run() {
+    int count = 0, failed = 0;
+    for (TestCase* t = testList(); t; t = t->next) {
+      bool ok = true;
+      t->body(ok);
+      printf("%s %s\n", ok ? "PASS" : "FAIL", t->name);
+      count++;
+      if (!ok) failed++;
+    }
+    printf("%d tests, %d failed\n", count, failed);
+    fflush(stdout);
+    exit(failed);
+  }
+};
+
+} // namespace aunit
+
+#define test(suite, name)                                                           \
+  static void suite##_##name##_body(bool& aunitOk);                                 \
+  static aunit::TestCase suite##_##name##_case = {#suite "." #name, suite##_##name##_body, nullptr}; \
+  static aunit::TestRegistration suite##_##name##_reg(suite##_##name##_case);       \
+  static void suite##_##name##_body(bool& aunitOk)
+
+#define AUNIT_CHECK(cond, what)                            \
+  do {                                                     \
+    if (!(cond)) {                                         \
+      aunit::fail(aunitOk, __FILE__, __LINE__, what);      \
+      return;                                              \
+    }                                                      \
+  } while (0)
+
+#define assertTrue(a) AUNIT_CHECK((a), #a)
+#define assertFalse(a) AUNIT_CHECK(!(a), "!(" #a ")")
+#define assertEqual(a, b) AUNIT_CHECK((a) == (b), #a " == " #b)
+#define assertNotEqual(a, b) AUNIT_CHECK(!((a) == (b)), #a " != " #b)
+#define assertLess(a, b) AUNIT_CHECK((a) < (b), #a " < " #b)
+#define assertMore(a, b) AUNIT_CHECK((a) > (b), #a " > " #b)
+#define assertLessOrEqual(a, b) AUNIT_CHECK((a) <= (b), #a " <= " #b)
+#define assertMoreOrEqual(a, b) AUNIT_CHECK((a) >= (b), #a " >= " #b)
+#define assertNear(a, b, error) AUNIT_CHECK(fabs((double)(a) - (double)(b)) <= (double)(error), #a " ~ " #b)
+
+#endif
@@ -0,0 +1,178 @@
+#ifndef VIEWS_HOST_ARDUINO_H
+#define VIEWS_HOST_ARDUINO_H
+
+/*
+ * A small Arduino compatibility layer for building the library on a desktop
+ * compiler (tests, sanitizers, fuzzing, profiling). It covers what the
+ * library and its test sketches use: PROGMEM access, F(), String, Print,
+ * Printable, Serial and the time functions. Program memory is ordinary
+ * memory here, and Serial writes to stdout.
+ *
+ * The top-level CMakeLists.txt puts this directory on the include path of
+ * every host target.
+ */
+
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "Printable.h"
+
+// --- Program memory ---
+
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
+#define memcpy_P memcpy
+#define memcmp_P memcmp
+#define strlen_P strlen
+
+class __FlashStringHelper;
+#define F(literal) (reinterpret_cast<const __FlashStringHelper*>(PSTR(literal)))
+
+// --- Time ---
+
+namespace views_host {
+inline std::chrono::steady_clock::time_point startTime() {
+  static const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+  return t0;
+}
+} // namespace views_host
+
+inline unsigned long micros() {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+           std::chrono::steady_clock::now() - views_host::startTime()).count();
+}
+
+inline unsigned long millis() { return micros() / 1000UL; }
+
+inline void delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+// --- String ---
+
+/** @brief The parts of Arduino's String the library converts to and from. */
+class String {
+public:
+  String(const char* s = "") : _s(s ? s : "") {}
+  String(const __FlashStringHelper* s) : _s(s ? reinterpret_cast<const char*>(s) : "") {}
+  String(char c) : _s(1, c) {}
+  explicit String(long v) : _s(std::to_string(v)) {}
+
+  const char* c_str() const { return _s.c_str(); }
+  unsigned int length() const { return (unsigned int)_s.size(); }
+  bool reserve(unsigned int n) {
+    _s.reserve(n);
+    return true;
+  }
+  bool concat(const char* p, unsigned int n) {
+    _s.append(p, n);
+    return true;
+  }
+  char operator[](unsigned int i) const { return i < _s.size() ? _s[i] : '\0'; }
+
+  String& operator+=(char c) {
+    _s += c;
+    return *this;
+  }
+  String& operator+=(const char* s) {
+    _s += s;
+    return *this;
+  }
+  String& operator+=(const String& s) {
+    _s += s._s;
+    return *this;
+  }
+
+  bool operator==(const String& s) const { return _s == s._s; }
+  bool operator==(const char* s) const { return s && _s == s; }
+  bool operator!=(const String& s) const { return _s != s._s; }
+
+private:
+  std::string _s;
+};
+
+// --- Print ---
+
+/** @brief Arduino's Print: write() is the only required override. */
+class Print {
+public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* data, size_t n) {
+    size_t written = 0;
+    while (n--) written += write(*data++);
+    return written;
+  }
+  size_t write(const char* s) { return s ? write(reinterpret_cast<const uint8_t*>(s), strlen(s)) : 0; }
+  size_t write(const char* data, size_t n) { return write(reinterpret_cast<const uint8_t*>(data), n); }
+
+  virtual int availableForWrite() { return 0; }
+  virtual void flush() {}
+
+  size_t print(const char* s) { return write(s); }
+  size_t print(const __FlashStringHelper* s) { return write(reinterpret_cast<const char*>(s)); }
+  size_t print(const String& s) { return write(s.c_str(), s.length()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(const Printable& p) { return p.printTo(*this); }
+  size_t print(int v, int base = 10) { return print((long)v, base); }
+  size_t print(unsigned int v, int base = 10) { return print((unsigned long)v, base); }
+  size_t print(long v, int base = 10) {
+    if (base == 10 && v < 0) return print('-') + printNumber(0UL - (unsigned long)v, 10);
+    return printNumber((unsigned long)v, base);
+  }
+  size_t print(unsigned long v, int base = 10) { return printNumber(v, base); }
+  size_t print(double v, int digits = 2) {
+    char buf[64];
+    int n = snprintf(buf, sizeof(buf), "%.*f", digits, v);
+    return write(buf, n > 0 ? (size_t)n : 0);
+  }
+
+  size_t println() { return write("\r\n"); }
+  template<typename T>
+  size_t println(const T& v) { return print(v) + println(); }
+  template<typename T>
+  size_t println(const T& v, int format) { return print(v, format) + println(); }
+
+private:
+  size_t printNumber(unsigned long v, int base) {
+    if (base < 2) base = 10;
+    char buf[8 * sizeof(long) + 1];
+    char* p = buf + sizeof(buf);
+    do {
+      unsigned d = (unsigned)(v % (unsigned long)base);
+      *--p = (char)(d < 10 ? '0' + d : 'A' + d - 10);
+      v /= (unsigned long)base;
+    } while (v);
+    return write(p, (size_t)(buf + sizeof(buf) - p));
+  }
+};
+
+/** @brief Serial on stdout (nothing to read). */
+class HostSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  operator bool() const { return true; }
+  int available() { return 0; }
+  int read() { return -1; }
+
+  size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+  size_t write(const uint8_t* data, size_t n) override { return fwrite(data, 1, n, stdout); }
+  using Print::write;
+  void flush() override { fflush(stdout); }
+};
+
+static HostSerial Serial;
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef VIEWS_HOST_PRINTABLE_H
+#define VIEWS_HOST_PRINTABLE_H
+
+#include <stddef.h>
+
+class Print;
+
+/**
+ * @brief Host stand-in for the Arduino Printable interface. Like the AVR
+ * core's, it has no virtual destructor, so StringView stays a literal type.
+ */
+class Printable {
+public:
+  virtual size_t printTo(Print& p) const = 0;
+};
+
+#endif
@@ -0,0 +1,13 @@
+// Runs an Arduino sketch on the host: setup(), then loop() until the sketch
+// exits (AUnit's TestRunner::run() does) or `loops` calls have been made.
+#include <stdlib.h>
+
+void setup();
+void loop();
+
+int main(int argc, char** argv) {
+  long loops = argc > 1 ? atol(argv[1]) : 1;
+  setup();
+  for (long i = 0; i < loops; i++) loop();
+  return 0;
+}
@@ -0,0 +1,250 @@
+#ifndef BUFFER_WRITER_H
+#define BUFFER_WRITER_H
+
+#include "Views.h"
+
+namespace view_detail {
+
+/** @brief Writes v in decimal ending just before end, two digits per divide. */
+template<typename U>
+char* formatDecimal(char* end, U v) {
+  static const char pairs[] VIEWS_FLASH =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+  char* p = end;
+  while (v >= 100) {
+    uint8_t r = (uint8_t)(v % 100);
+    v /= 100;
+    p -= 2;
+    VIEWS_FLASH_READ(p, &pairs[r * 2], 2);
+  }
+  if (v >= 10) {
+    p -= 2;
+    VIEWS_FLASH_READ(p, &pairs[v * 2], 2);
+  } else {
+    *--p = (char)('0' + v);
+  }
+  return p;
+}
+
+} // namespace view_detail
+
+/**
+ * @class BufferWriter
+ * @brief Formats text into a caller-supplied buffer without touching the heap.
+ *
+ * The buffer is kept null-terminated, so one byte of the capacity is reserved.
+ * When an append does not fit, the overflow flag is set: views and raw bytes
+ * are truncated, numbers are dropped whole so no partial number is emitted.
+ * Also a Print, so anything printable (including StringView) can target it.
+ */
+class BufferWriter : public Print {
+public:
+  /** @brief Writes into buffer[0, capacity). */
+  BufferWriter(char* buffer, size_t capacity)
+    : _buf(capacity ? buffer : nullptr), _cap(capacity ? capacity - 1 : 0), _len(0),
+      _overflow(false) {
+    if (_buf) _buf[0] = '\0';
+  }
+
+  /** @brief Writes into a fixed-size array. */
+  template<size_t N>
+  BufferWriter(char (&buffer)[N]) : BufferWriter(buffer, N) {}
+
+  // --- Print interface ---
+
+  size_t write(uint8_t c) override {
+    if (_len >= _cap) {
+      _overflow = true;
+      return 0;
+    }
+    _buf[_len++] = (char)c;
+    _buf[_len] = '\0';
+    return 1;
+  }
+
+  size_t write(const uint8_t* data, size_t n) override {
+    if (n > _cap - _len) {
+      _overflow = true;
+      n = _cap - _len;
+    }
+    if (n == 0) return 0;
+    memcpy(_buf + _len, data, n);
+    _len += n;
+    _buf[_len] = '\0';
+    return n;
+  }
+
+  using Print::write;
+
+  int availableForWrite() override { return (int)(_cap - _len); }
+
+  // --- Appending ---
+
+  /** @brief Appends a view (truncated if it does not fit). */
+  BufferWriter& append(const MemoryView<char>& s) {
+    write(reinterpret_cast<const uint8_t*>(s.data()), s.length());
+    return *this;
+  }
+
+  /** @brief Appends a C-string. */
+  BufferWriter& append(const char* s) { return append(StringView(s)); }
+
+  /** @brief Appends one character. */
+  BufferWriter& append(char c) {
+    write((uint8_t)c);
+    return *this;
+  }
+
+  /** @brief Appends an integer of any width in decimal. */
+  template<typename T>
+  BufferWriter& appendInt(T value) {
+    typedef typename view_detail::Conditional<(sizeof(T) > 4), uint64_t, uint32_t>::type U;
+    char tmp[21];
+    char* end = tmp + sizeof(tmp);
+    bool neg = value < 0;
+    U mag = neg ? (U)0 - (U)value : (U)value;
+    char* p = view_detail::formatDecimal(end, mag);
+    if (neg) *--p = '-';
+    return appendWhole(p, end - p);
+  }
+
+  /**
+   * @brief Appends a hexadecimal number.
+   * @param minDigits Pad with leading zeros to at least this many digits.
+   * @param upper Use A-F instead of a-f.
+   */
+  BufferWriter& appendHex(uint32_t value, uint8_t minDigits = 1, bool upper = true) {
+    const char* digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    char tmp[8];
+    char* end = tmp + sizeof(tmp);
+    char* p = end;
+    if (minDigits > sizeof(tmp)) minDigits = sizeof(tmp);
+    do {
+      *--p = digits[value & 0xF];
+      value >>= 4;
+    } while (value || end - p < minDigits);
+    return appendWhole(p, end - p);
+  }
+
+  /** @brief Appends every byte as two hex digits (e.g. a BLE payload). */
+  BufferWriter& appendHex(const MemoryView<uint8_t>& bytes, bool upper = true) {
+    if (bytes.length() * 2 > _cap - _len) {
+      _overflow = true;
+      return *this;
+    }
+    for (size_t i = 0; i < bytes.length(); i++) appendHex(bytes[i], 2, upper);
+    return *this;
+  }
+
+  /**
+   * @brief Appends a scaled integer as a decimal ("21500", 3 gives "21.500").
+   * The counterpart of StringView::parseFixedPoint; uses no floating point.
+   */
+  BufferWriter& appendFixed(int32_t value, uint8_t decimals) {
+    char tmp[13];
+    char* end = tmp + sizeof(tmp);
+    bool neg = value < 0;
+    uint32_t mag = neg ? 0UL - (uint32_t)value : (uint32_t)value;
+    if (decimals > 9) decimals = 9;
+    char* p = end;
+    if (decimals) {
+      uint32_t div = view_detail::pow10u32(decimals);
+      uint32_t frac = mag % div;
+      mag /= div;
+      p = view_detail::formatDecimal(end, frac);
+      while (end - p < decimals) *--p = '0';
+      *--p = '.';
+    }
+    p = view_detail::formatDecimal(p, mag);
+    if (neg) *--p = '-';
+    return appendWhole(p, end - p);
+  }
+
+  /**
+   * @brief Appends a float with a fixed number of decimals (rounded).
+   * Like Arduino's Print, magnitudes above 4294967040 are written as "ovf".
+   */
+  BufferWriter& appendFloat(double value, uint8_t decimals = 2) {
+    if (isnan(value)) return appendWhole("nan", 3);
+    if (isinf(value)) return value < 0 ? appendWhole("-inf", 4) : appendWhole("inf", 3);
+    if (value > 4294967040.0 || value < -4294967040.0) return appendWhole("ovf", 3);
+    if (decimals > 9) decimals = 9;
+    bool neg = value < 0;
+    if (neg) value = -value;
+    uint32_t scale = view_detail::pow10u32(decimals);
+    value += 0.5 / scale;
+    uint32_t whole = (uint32_t)value;
+    uint32_t frac = (uint32_t)((value - whole) * scale);
+    if (frac >= scale) frac = scale - 1;
+    char tmp[22];
+    char* end = tmp + sizeof(tmp);
+    char* p = end;
+    if (decimals) {
+      p = view_detail::formatDecimal(end, frac);
+      while (end - p < decimals) *--p = '0';
+      *--p = '.';
+    }
+    p = view_detail::formatDecimal(p, whole);
+    if (neg && (whole || frac)) *--p = '-';
+    return appendWhole(p, end - p);
+  }
+
+  // --- State ---
+
+  /** @brief The text written so far. */
+  StringView view() const { return StringView(_buf, _len); }
+
+  /** @brief The text written so far, null-terminated. */
+  const char* c_str() const { return _buf; }
+
+  /** @brief Number of characters written. */
+  size_t length() const { return _len; }
+
+  /** @brief Maximum number of characters (excluding the terminator). */
+  size_t capacity() const { return _cap; }
+
+  /** @brief Characters that can still be appended. */
+  size_t remaining() const { return _cap - _len; }
+
+  /** @brief True if any append did not fit. */
+  bool overflowed() const { return _overflow; }
+
+  /** @brief Empties the buffer and clears the overflow flag. */
+  void clear() {
+    _len = 0;
+    _overflow = false;
+    if (_buf) _buf[0] = '\0';
+  }
+
+private:
+  /** @brief Appends p[0, n) only if all of it fits. */
+  BufferWriter& appendWhole(const char* p, size_t n) {
+    if (n > _cap - _len) _overflow = true;
+    else write(reinterpret_cast<const uint8_t*>(p), n);
+    return *this;
+  }
+
+  char* _buf;
+  size_t _cap;
+  size_t _len;
+  bool _overflow;
+};
+
+/**
+ * @class StaticBufferWriter
+ * @brief BufferWriter that owns an N-byte buffer (on the stack or static).
+ */
+template<size_t N>
+class StaticBufferWriter : public BufferWriter {
+public:
+  StaticBufferWriter() : BufferWriter(_storage, N) {}
+  StaticBufferWriter(const StaticBufferWriter&) = delete;
+  StaticBufferWriter& operator=(const StaticBufferWriter&) = delete;
+
+private:
+  char _storage[N];
+};
+
+#endif
@@ -0,0 +1,199 @@
+#ifndef BYTE_READER_H
+#define BYTE_READER_H
+
+#include "Views.h"
+
+/**
+ * @brief Set to 0 to compile ByteReader without bounds checks.
+ * Only do this for frames whose length has already been validated.
+ */
+#ifndef VIEWS_BYTEREADER_BOUNDS_CHECK
+#define VIEWS_BYTEREADER_BOUNDS_CHECK 1
+#endif
+
+/**
+ * @brief 1 if the target can load multi-byte values from any address.
+ * Then memcpy of a value compiles to a single load; otherwise values are
+ * assembled from bytes, which never faults (Cortex-M0, ESP8266, ...).
+ */
+#ifndef VIEWS_UNALIGNED_LOADS
+#if defined(__i386__) || defined(__x86_64__) || defined(__ARM_FEATURE_UNALIGNED) || defined(__AVR__)
+#define VIEWS_UNALIGNED_LOADS 1
+#else
+#define VIEWS_UNALIGNED_LOADS 0
+#endif
+#endif
+
+/** @brief Byte order of a value in a frame. */
+enum class Endian : uint8_t { Little, Big };
+
+namespace view_detail {
+
+template<size_t N> struct UintOfSize;
+template<> struct UintOfSize<1> { typedef uint8_t type; };
+template<> struct UintOfSize<2> { typedef uint16_t type; };
+template<> struct UintOfSize<4> { typedef uint32_t type; };
+template<> struct UintOfSize<8> { typedef uint64_t type; };
+
+inline uint8_t byteSwap(uint8_t v) { return v; }
+inline uint16_t byteSwap(uint16_t v) { return __builtin_bswap16(v); }
+inline uint32_t byteSwap(uint32_t v) { return __builtin_bswap32(v); }
+inline uint64_t byteSwap(uint64_t v) { return __builtin_bswap64(v); }
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+const Endian kHostEndian = Endian::Big;
+#else
+const Endian kHostEndian = Endian::Little;
+#endif
+
+/** @brief Loads an unsigned integer stored with byte order e at p (any alignment). */
+template<typename U>
+U loadUint(const uint8_t* p, Endian e) {
+#if VIEWS_UNALIGNED_LOADS
+  U v;
+  memcpy(&v, p, sizeof(U));
+  return (e == kHostEndian) ? v : byteSwap(v);
+#else
+  U v = 0;
+  if (e == Endian::Little)
+    for (size_t i = sizeof(U); i-- > 0;) v = (U)((v << 8) | p[i]);
+  else
+    for (size_t i = 0; i < sizeof(U); i++) v = (U)((v << 8) | p[i]);
+  return v;
+#endif
+}
+
+/** @brief Loads any trivially copyable arithmetic value (int, float) of byte order e. */
+template<typename T>
+T loadValue(const uint8_t* p, Endian e) {
+  typedef typename UintOfSize<sizeof(T)>::type U;
+  U raw = loadUint<U>(p, e);
+  T v;
+  memcpy(&v, &raw, sizeof(T));
+  return v;
+}
+
+} // namespace view_detail
+
+/**
+ * @class ByteReader
+ * @brief Cursor over a byte view that decodes integers and floats of either
+ * byte order without unaligned loads or casts.
+ *
+ * A read past the end returns 0, leaves the cursor in place and clears ok(),
+ * which stays cleared, so a whole frame can be decoded and checked once.
+ */
+class ByteReader {
+public:
+  /** @brief Reads from bytes, starting at offset 0. */
+  explicit ByteReader(const MemoryView<uint8_t>& bytes) : _bytes(bytes), _pos(0), _ok(true) {}
+
+  /** @brief Reads from data[0, len), starting at offset 0. */
+  ByteReader(const uint8_t* data, size_t len) : _bytes(data, len), _pos(0), _ok(true) {}
+
+  // --- Cursor ---
+
+  /** @brief Current offset from the start of the view. */
+  size_t position() const { return _pos; }
+
+  /** @brief Bytes left after the cursor. */
+  size_t remaining() const { return _bytes.length() - _pos; }
+
+  /** @brief False once any read or seek went out of bounds. */
+  bool ok() const { return _ok; }
+
+  /** @brief Moves the cursor to an absolute offset. */
+  ByteReader& seek(size_t offset) {
+    if (fits(0, offset)) _pos = offset;
+    return *this;
+  }
+
+  /** @brief Advances the cursor by n bytes. */
+  ByteReader& skip(size_t n) {
+    if (fits(_pos, n)) _pos += n;
+    return *this;
+  }
+
+  // --- Sequential Reads ---
+
+  /** @brief Reads a T stored with byte order e and advances the cursor. */
+  template<typename T>
+  T read(Endian e = Endian::Little) {
+    if (!fits(_pos, sizeof(T))) return T();
+    T v = view_detail::loadValue<T>(_bytes.data() + _pos, e);
+    _pos += sizeof(T);
+    return v;
+  }
+
+  uint8_t u8() { return read<uint8_t>(); }
+  int8_t i8() { return read<int8_t>(); }
+  uint16_t u16le() { return read<uint16_t>(Endian::Little); }
+  uint16_t u16be() { return read<uint16_t>(Endian::Big); }
+  int16_t i16le() { return read<int16_t>(Endian::Little); }
+  int16_t i16be() { return read<int16_t>(Endian::Big); }
+  uint32_t u32le() { return read<uint32_t>(Endian::Little); }
+  uint32_t u32be() { return read<uint32_t>(Endian::Big); }
+  int32_t i32le() { return read<int32_t>(Endian::Little); }
+  int32_t i32be() { return read<int32_t>(Endian::Big); }
+  uint64_t u64le() { return read<uint64_t>(Endian::Little); }
+  uint64_t u64be() { return read<uint64_t>(Endian::Big); }
+  float f32le() { return read<float>(Endian::Little); }
+  float f32be() { return read<float>(Endian::Big); }
+
+  /** @brief Returns the next n bytes as a sub-view (no copy) and advances. */
+  MemoryView<uint8_t> bytes(size_t n) {
+    if (!fits(_pos, n)) return MemoryView<uint8_t>();
+    MemoryView<uint8_t> v(_bytes.data() + _pos, n);
+    _pos += n;
+    return v;
+  }
+
+  /**
+   * @brief Decodes n consecutive values into out and advances.
+   * Matching byte order is a single memcpy; otherwise each value is swapped.
+   * @return n, or 0 (nothing read) if fewer than n values remain.
+   */
+  template<typename T>
+  size_t readArray(T* out, size_t n, Endian e = Endian::Little) {
+    size_t total = (n > remaining() / sizeof(T)) ? (size_t)-1 : n * sizeof(T);
+    if (!fits(_pos, total)) return 0;
+    const uint8_t* p = _bytes.data() + _pos;
+    if (e == view_detail::kHostEndian || sizeof(T) == 1) {
+      memcpy(out, p, n * sizeof(T));
+    } else {
+      for (size_t i = 0; i < n; i++, p += sizeof(T)) out[i] = view_detail::loadValue<T>(p, e);
+    }
+    _pos += total;
+    return n;
+  }
+
+  // --- Random Access ---
+
+  /** @brief Reads a T at an absolute offset without moving the cursor. */
+  template<typename T>
+  T peek(size_t offset, Endian e = Endian::Little) {
+    if (!fits(offset, sizeof(T))) return T();
+    return view_detail::loadValue<T>(_bytes.data() + offset, e);
+  }
+
+private:
+  /** @brief True if [start, start + n) lies inside the view; clears ok() if not. */
+  bool fits(size_t start, size_t n) {
+#if VIEWS_BYTEREADER_BOUNDS_CHECK
+    if (start > _bytes.length() || n > _bytes.length() - start) {
+      _ok = false;
+      return false;
+    }
+#else
+    (void)start;
+    (void)n;
+#endif
+    return true;
+  }
+
+  MemoryView<uint8_t> _bytes;
+  size_t _pos;
+  bool _ok;
+};
+
+#endif
@@ -0,0 +1,332 @@
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#include "Views.h"
+#include "RingView.h"
+
+/**
+ * @brief Process reflected 32-bit CRCs (Crc32, Crc32C) four bytes per step
+ * with four 256-entry tables (4 KB of flash) instead of one byte per step
+ * with one. Off by default on AVR, where the flash matters more than the speed.
+ */
+#ifndef VIEWS_CRC_SLICE_BY_4
+#if defined(__AVR__)
+#define VIEWS_CRC_SLICE_BY_4 0
+#else
+#define VIEWS_CRC_SLICE_BY_4 1
+#endif
+#endif
+
+/**
+ * @brief Compute Crc32 with the ESP32 ROM routine (esp_rom_crc32_le), which
+ * costs no flash for tables. On by default for ESP-IDF based builds.
+ */
+#ifndef VIEWS_USE_ESP32_ROM_CRC
+#if defined(ESP_PLATFORM) && defined(__has_include)
+#if __has_include(<esp_rom_crc.h>)
+#define VIEWS_USE_ESP32_ROM_CRC 1
+#endif
+#endif
+#endif
+#ifndef VIEWS_USE_ESP32_ROM_CRC
+#define VIEWS_USE_ESP32_ROM_CRC 0
+#endif
+
+/**
+ * @brief Compute Crc32 with the STM32 CRC peripheral, a word per bus write.
+ * Off by default: define to 1 on families with programmable input/output
+ * reversal (F0, F3, F7, G0, G4, H7, L0, L4, ...) after enabling the CRC clock
+ * (e.g. `__HAL_RCC_CRC_CLK_ENABLE()`). The peripheral is shared, so Crc32
+ * updates must not run from interrupts while another one is in progress.
+ */
+#ifndef VIEWS_USE_STM32_CRC
+#define VIEWS_USE_STM32_CRC 0
+#endif
+
+#if VIEWS_USE_ESP32_ROM_CRC
+#include <esp_rom_crc.h>
+#endif
+
+namespace view_detail {
+
+/** @brief The low `bits` bits of v in reverse order. */
+template<typename U>
+constexpr U reverseBits(U v, uint8_t bits, U r = 0) {
+  return bits == 0 ? r : reverseBits<U>((U)(v >> 1), (uint8_t)(bits - 1), (U)((r << 1) | (v & 1)));
+}
+
+/** @brief Table entries of a CRC, computed bit by bit by the compiler. */
+template<typename U, U Poly, bool Reflect>
+struct CrcTableGen {
+  static constexpr uint8_t kBits = sizeof(U) * 8;
+  static constexpr U kReflected = reverseBits<U>(Poly, kBits);
+  static constexpr U kTop = (U)((U)1 << (kBits - 1));
+
+  static constexpr U step(U r) {
+    return Reflect ? ((r & 1) ? (U)((r >> 1) ^ kReflected) : (U)(r >> 1))
+                   : ((r & kTop) ? (U)((U)(r << 1) ^ Poly) : (U)(r << 1));
+  }
+  static constexpr U steps(U r, uint8_t k) { return k == 0 ? r : steps(step(r), (uint8_t)(k - 1)); }
+
+  /** @brief CRC register after shifting in byte value i from zero. */
+  static constexpr U at(size_t i) {
+    return steps(Reflect ? (U)i : (U)((U)i << (kBits - 8)), 8);
+  }
+};
+
+/** @brief Four chained byte tables for slice-by-4: entry 256 * k + b is b followed by k zero bytes. */
+template<typename U, U Poly>
+struct CrcSliceGen {
+  typedef CrcTableGen<U, Poly, true> Base;
+  static constexpr U at(size_t i) { return sliced(i >> 8, i & 0xFF); }
+  static constexpr U sliced(size_t k, size_t b) {
+    return k == 0 ? Base::at(b) : (U)((sliced(k - 1, b) >> 8) ^ Base::at(sliced(k - 1, b) & 0xFF));
+  }
+};
+
+/** @brief Byte-at-a-time table update of the CRC register. */
+template<typename U, U Poly, bool Reflect>
+U crcBytes(U reg, const uint8_t* p, size_t n) {
+  typedef FlashTable<U, CrcTableGen<U, Poly, Reflect>, typename MakeIndexSeq<256>::type> Table;
+  const U* table = Table::data();
+  const uint8_t shift = sizeof(U) * 8 - 8;
+  for (size_t i = 0; i < n; i++) {
+    if (Reflect)
+      reg = (U)(flashRead(&table[(uint8_t)(reg ^ p[i])]) ^ (sizeof(U) > 1 ? (reg >> 8) : 0));
+    else
+      reg = (U)(flashRead(&table[(uint8_t)((reg >> shift) ^ p[i])]) ^ (sizeof(U) > 1 ? (U)(reg << 8) : 0));
+  }
+  return reg;
+}
+
+/** @brief Software CRC: slice-by-4 where enabled and applicable, else bytewise. */
+template<typename U, U Poly, bool Reflect,
+         bool Slice = VIEWS_CRC_SLICE_BY_4 && Reflect && sizeof(U) == 4>
+struct CrcSoftware {
+  static U update(U reg, const uint8_t* p, size_t n) { return crcBytes<U, Poly, Reflect>(reg, p, n); }
+};
+
+template<typename U, U Poly, bool Reflect>
+struct CrcSoftware<U, Poly, Reflect, true> {
+  static U update(U reg, const uint8_t* p, size_t n) {
+    typedef FlashTable<U, CrcSliceGen<U, Poly>, typename MakeIndexSeq<1024>::type> Table;
+    const U* t = Table::data();
+    for (; n >= 4; n -= 4, p += 4) {
+      reg ^= loadLE32(p);
+      reg = flashRead(&t[768 + (reg & 0xFF)]) ^ flashRead(&t[512 + ((reg >> 8) & 0xFF)]) ^
+            flashRead(&t[256 + ((reg >> 16) & 0xFF)]) ^ flashRead(&t[reg >> 24]);
+    }
+    return crcBytes<U, Poly, Reflect>(reg, p, n);
+  }
+};
+
+/** @brief Where a CRC is computed; hardware engines specialise this. */
+template<typename U, U Poly, bool Reflect>
+struct CrcEngine : CrcSoftware<U, Poly, Reflect> {};
+
+#if VIEWS_USE_ESP32_ROM_CRC
+/** @brief Crc32 in ROM: the ROM routine complements on entry and exit. */
+template<>
+struct CrcEngine<uint32_t, 0x04C11DB7UL, true> {
+  static uint32_t update(uint32_t reg, const uint8_t* p, size_t n) {
+    return ~esp_rom_crc32_le(~reg, p, (uint32_t)n);
+  }
+};
+#elif VIEWS_USE_STM32_CRC && defined(CRC_CR_REV_IN) && defined(CRC_CR_REV_OUT)
+/**
+ * @brief Crc32 on the STM32 peripheral. Words are bit-reversed on input and
+ * the result on output, so the peripheral's MSB-first register holds the
+ * reflected CRC; the tail of under four bytes goes through the table.
+ */
+template<>
+struct CrcEngine<uint32_t, 0x04C11DB7UL, true> {
+  static uint32_t update(uint32_t reg, const uint8_t* p, size_t n) {
+    if (n >= 4) {
+      CRC->INIT = __RBIT(reg);
+      CRC->CR = CRC_CR_REV_IN | CRC_CR_REV_OUT | CRC_CR_RESET;
+      for (; n >= 4; n -= 4, p += 4) CRC->DR = loadLE32(p);
+      reg = CRC->DR;
+    }
+    return crcBytes<uint32_t, 0x04C11DB7UL, true>(reg, p, n);
+  }
+};
+#endif
+
+} // namespace view_detail
+
+/**
+ * @class Crc
+ * @brief An incremental CRC in the parameters of the CRC catalogue: feed
+ * data in any number of pieces (packets, the two segments of a RingView, a
+ * stream read in chunks) and read value() at the end.
+ * @tparam U Register type: uint8_t, uint16_t or uint32_t.
+ * @tparam Poly Generator polynomial in normal (MSB-first) form.
+ * @tparam Init Initial register value.
+ * @tparam XorOut Value XORed into the register by value().
+ * @tparam Reflect True for LSB-first CRCs (input and output reflected).
+ *
+ * The lookup table is computed by the compiler and placed in flash
+ * (VIEWS_FLASH). Use the typedefs below for the common variants.
+ *
+ * @code
+ * Crc32 crc;
+ * crc.update(header).update(payload);
+ * if (crc.value() != expected) ...
+ * uint16_t fcs = Crc16Modbus::compute(frame.slice(0, frame.length() - 2));
+ * @endcode
+ */
+template<typename U, U Poly, U Init, U XorOut, bool Reflect>
+class Crc {
+  typedef view_detail::CrcEngine<U, Poly, Reflect> Engine;
+
+public:
+  /** @brief Starts a new CRC. */
+  Crc() : _reg(Init) {}
+
+  /** @brief Discards everything fed so far. */
+  void reset() { _reg = Init; }
+
+  // --- Feeding ---
+
+  /** @brief Feeds bytes. */
+  Crc& update(const MemoryView<uint8_t>& data) {
+    _reg = Engine::update(_reg, data.data(), data.length());
+    return *this;
+  }
+
+  /** @brief Feeds the characters of text. */
+  Crc& update(const StringView& text) {
+    _reg = Engine::update(_reg, reinterpret_cast<const uint8_t*>(text.data()), text.length());
+    return *this;
+  }
+
+  /** @brief Feeds one byte (e.g. from Serial.read()). */
+  Crc& update(uint8_t byte) {
+    _reg = Engine::update(_reg, &byte, 1);
+    return *this;
+  }
+
+  /** @brief Feeds a wrapped region of a ring buffer, both segments in order. */
+  Crc& update(const RingView<uint8_t>& data) { return update(data.first()).update(data.second()); }
+
+  /** @brief Feeds a wrapped region of a character ring buffer. */
+  Crc& update(const RingView<char>& text) {
+    return update(StringView(text.first())).update(StringView(text.second()));
+  }
+
+  // --- Result ---
+
+  /** @brief CRC of everything fed since construction or reset(). */
+  U value() const { return (U)(_reg ^ XorOut); }
+
+  /** @brief CRC of data in one call. */
+  static U compute(const MemoryView<uint8_t>& data) { return Crc().update(data).value(); }
+
+  /** @brief CRC of text in one call. */
+  static U compute(const StringView& text) { return Crc().update(text).value(); }
+
+private:
+  U _reg;
+};
+
+/** @brief CRC-8 (SMBus PEC, ATM HEC): poly 0x07, "123456789" -> 0xF4. */
+typedef Crc<uint8_t, 0x07, 0x00, 0x00, false> Crc8;
+/** @brief CRC-8/MAXIM (Dallas 1-Wire ROM and scratchpad): "123456789" -> 0xA1. */
+typedef Crc<uint8_t, 0x31, 0x00, 0x00, true> Crc8Maxim;
+/** @brief CRC-16/CCITT-FALSE (XMODEM-like framing, many sensors): "123456789" -> 0x29B1. */
+typedef Crc<uint16_t, 0x1021, 0xFFFF, 0x0000, false> Crc16Ccitt;
+/** @brief CRC-16/MODBUS (Modbus RTU, sent low byte first): "123456789" -> 0x4B37. */
+typedef Crc<uint16_t, 0x8005, 0xFFFF, 0x0000, true> Crc16Modbus;
+/** @brief CRC-32 (Ethernet, zlib, PNG): "123456789" -> 0xCBF43926. */
+typedef Crc<uint32_t, 0x04C11DB7UL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, true> Crc32;
+/** @brief CRC-32C (Castagnoli; iSCSI, ext4, SCTP): "123456789" -> 0xE3069283. */
+typedef Crc<uint32_t, 0x1EDC6F41UL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, true> Crc32C;
+
+/**
+ * @class XxHash32
+ * @brief Incremental xxHash32, equal to StringView::hash() over the
+ * concatenation of everything fed. Not cryptographic; use it to key hash
+ * tables or detect changed content, not to authenticate it.
+ */
+class XxHash32 {
+public:
+  /** @brief Starts a new hash with the given seed. */
+  explicit XxHash32(uint32_t seed = 0) { reset(seed); }
+
+  /** @brief Discards everything fed so far. */
+  void reset(uint32_t seed = 0) {
+    using namespace view_detail;
+    _seed = seed;
+    _v[0] = seed + kXxhPrime1 + kXxhPrime2;
+    _v[1] = seed + kXxhPrime2;
+    _v[2] = seed;
+    _v[3] = seed - kXxhPrime1;
+    _total = 0;
+    _buffered = 0;
+  }
+
+  // --- Feeding ---
+
+  /** @brief Feeds bytes. */
+  XxHash32& update(const MemoryView<uint8_t>& data) { return feed(data.data(), data.length()); }
+
+  /** @brief Feeds the characters of text. */
+  XxHash32& update(const StringView& text) {
+    return feed(reinterpret_cast<const uint8_t*>(text.data()), text.length());
+  }
+
+  /** @brief Feeds one byte. */
+  XxHash32& update(uint8_t byte) { return feed(&byte, 1); }
+
+  /** @brief Feeds a wrapped region of a ring buffer, both segments in order. */
+  XxHash32& update(const RingView<uint8_t>& data) { return update(data.first()).update(data.second()); }
+
+  /** @brief Feeds a wrapped region of a character ring buffer. */
+  XxHash32& update(const RingView<char>& text) {
+    return update(StringView(text.first())).update(StringView(text.second()));
+  }
+
+  // --- Result ---
+
+  /** @brief Hash of everything fed so far (feeding may continue). */
+  uint32_t value() const {
+    using namespace view_detail;
+    uint32_t h = (_total >= 16)
+      ? rotl32(_v[0], 1) + rotl32(_v[1], 7) + rotl32(_v[2], 12) + rotl32(_v[3], 18)
+      : _seed + kXxhPrime5;
+    return xxh32Finish(h + _total, _buffer, _buffered);
+  }
+
+private:
+  XxHash32& feed(const uint8_t* p, size_t n) {
+    if (n == 0) return *this;
+    _total += (uint32_t)n;
+    if (_buffered) {
+      size_t take = (n < 16u - _buffered) ? n : 16u - _buffered;
+      memcpy(_buffer + _buffered, p, take);
+      _buffered += (uint8_t)take;
+      p += take;
+      n -= take;
+      if (_buffered < 16) return *this;
+      stripe(_buffer);
+      _buffered = 0;
+    }
+    for (; n >= 16; n -= 16, p += 16) stripe(p);
+    if (n) memcpy(_buffer, p, n);
+    _buffered = (uint8_t)n;
+    return *this;
+  }
+
+  void stripe(const uint8_t* p) {
+    using namespace view_detail;
+    for (uint8_t i = 0; i < 4; i++) _v[i] = xxh32Round(_v[i], loadLE32(p + 4 * i));
+  }
+
+  uint32_t _v[4];
+  uint32_t _seed;
+  uint32_t _total;
+  uint8_t _buffer[16];
+  uint8_t _buffered;
+};
+
+#endif
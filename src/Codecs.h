@@ -0,0 +1,494 @@
+#ifndef CODECS_H
+#define CODECS_H
+
+#include "Views.h"
+#include "MutableView.h"
+
+/** @brief Why a codec stopped. */
+enum class CodecStatus : uint8_t {
+  Ok,         ///< All input was converted.
+  Invalid,    ///< A character outside the encoding; consumed stops before its unit.
+  Incomplete, ///< Input ended inside a unit ("%4", "\\u12", an odd hex digit):
+              ///< keep the unconsumed rest and prepend it to the next chunk.
+  NoRoom      ///< The output is full; consumed stops at the first unit that did not fit.
+};
+
+/**
+ * @brief Outcome of an encode or decode. Conversion stops at the first
+ * problem, with everything before it converted, so a stream can be processed
+ * chunk by chunk: resume at input + consumed.
+ */
+struct CodecResult {
+  size_t consumed;  ///< Input elements converted.
+  size_t written;   ///< Output elements written.
+  CodecStatus status;
+
+  /** @brief True if the whole input was converted. */
+  bool ok() const { return status == CodecStatus::Ok; }
+};
+
+namespace view_detail {
+
+inline CodecResult codecResult(size_t consumed, size_t written, CodecStatus status) {
+  CodecResult r = {consumed, written, status};
+  return r;
+}
+
+inline char hexDigit(uint8_t nibble, char ten) { return (char)(nibble < 10 ? '0' + nibble : ten + nibble - 10); }
+
+/** @brief Base64 character -> 6-bit value, or 0xFF; accepts both the standard and URL alphabets. */
+struct Base64DecodeGen {
+  static constexpr uint8_t at(size_t c) {
+    return (c >= 'A' && c <= 'Z') ? (uint8_t)(c - 'A')
+         : (c >= 'a' && c <= 'z') ? (uint8_t)(c - 'a' + 26)
+         : (c >= '0' && c <= '9') ? (uint8_t)(c - '0' + 52)
+         : (c == '+' || c == '-') ? 62
+         : (c == '/' || c == '_') ? 63
+         : 0xFF;
+  }
+};
+
+/** @brief 6-bit value -> Base64 character. */
+template<bool UrlSafe>
+struct Base64EncodeGen {
+  static constexpr char at(size_t v) {
+    return (v < 26) ? (char)('A' + v)
+         : (v < 52) ? (char)('a' + v - 26)
+         : (v < 62) ? (char)('0' + v - 52)
+         : (v == 62) ? (UrlSafe ? '-' : '+')
+         : (UrlSafe ? '_' : '/');
+  }
+};
+
+template<bool UrlSafe>
+const char* base64Alphabet() {
+  return FlashTable<char, Base64EncodeGen<UrlSafe>, typename MakeIndexSeq<64>::type>::data();
+}
+
+/** @brief Bytes needed to encode code point cp as UTF-8. */
+inline uint8_t utf8Length(uint32_t cp) { return (cp < 0x80) ? 1 : (cp < 0x800) ? 2 : (cp < 0x10000) ? 3 : 4; }
+
+/** @brief Writes cp as UTF-8 to out (n = utf8Length(cp) bytes). */
+inline void putUtf8(char* out, uint8_t n, uint32_t cp) {
+  static const uint8_t lead[5] = {0, 0x00, 0xC0, 0xE0, 0xF0};
+  for (uint8_t i = n - 1; i > 0; i--, cp >>= 6) out[i] = (char)(0x80 | (cp & 0x3F));
+  out[0] = (char)(lead[n] | cp);
+}
+
+/** @brief Four hex digits at d; false if any is not a hex digit. */
+inline bool readHex4(const char* d, uint32_t& v) {
+  v = 0;
+  for (uint8_t i = 0; i < 4; i++) {
+    int h = hexValue(d[i]);
+    if (h < 0) return false;
+    v = (v << 4) | (uint32_t)h;
+  }
+  return true;
+}
+
+/** @brief True if the m < 6 bytes at p could be the start of a "\\uXXXX" escape. */
+inline bool couldStartEscape(const char* p, size_t m) {
+  if (m > 0 && p[0] != '\\') return false;
+  if (m > 1 && p[1] != 'u') return false;
+  for (size_t i = 2; i < m; i++) {
+    if (hexValue(p[i]) < 0) return false;
+  }
+  return true;
+}
+
+/**
+ * @brief JSON string unescape of d[0, n) into o[0, room). With o == nullptr
+ * nothing is written and the result only measures. Unpaired surrogates
+ * become U+FFFD; a high surrogate that may still be paired by the next
+ * chunk is Incomplete unless final.
+ */
+inline CodecResult jsonUnescape(const char* d, size_t n, char* o, size_t room, bool final) {
+  size_t r = 0, w = 0;
+  while (r < n) {
+    // Copy the run up to the next backslash in one go (memmove: may be in place).
+    const char* bs = (const char*)memchr(d + r, '\\', n - r);
+    size_t run = (bs ? (size_t)(bs - d) : n) - r;
+    if (run > room - w) {
+      if (o && room > w) memmove(o + w, d + r, room - w);
+      return codecResult(r + (room - w), room, CodecStatus::NoRoom);
+    }
+    if (o && run) memmove(o + w, d + r, run);
+    r += run;
+    w += run;
+    if (!bs) break;
+    if (r + 1 >= n) return codecResult(r, w, CodecStatus::Incomplete);
+    char c = d[r + 1];
+    size_t used = 2;
+    uint32_t cp;
+    switch (c) {
+      case '"': case '\\': case '/': cp = (uint8_t)c; break;
+      case 'b': cp = '\b'; break;
+      case 'f': cp = '\f'; break;
+      case 'n': cp = '\n'; break;
+      case 'r': cp = '\r'; break;
+      case 't': cp = '\t'; break;
+      case 'u':
+        if (n - r < 6) return codecResult(r, w, CodecStatus::Incomplete);
+        if (!readHex4(d + r + 2, cp)) return codecResult(r, w, CodecStatus::Invalid);
+        used = 6;
+        if (cp >= 0xD800 && cp < 0xDC00) {
+          // A high surrogate followed by \uDC00-\uDFFF is one supplementary code point.
+          uint32_t lo;
+          if (n - r < 12) {
+            if (!final && couldStartEscape(d + r + 6, n - r - 6)) return codecResult(r, w, CodecStatus::Incomplete);
+            cp = 0xFFFD;
+          } else if (d[r + 6] == '\\' && d[r + 7] == 'u' && readHex4(d + r + 8, lo) && lo >= 0xDC00 && lo < 0xE000) {
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+            used = 12;
+          } else {
+            cp = 0xFFFD;
+          }
+        } else if (cp >= 0xDC00 && cp < 0xE000) {
+          cp = 0xFFFD;   // low surrogate without a high one
+        }
+        break;
+      default:
+        return codecResult(r, w, CodecStatus::Invalid);
+    }
+    uint8_t len = utf8Length(cp);
+    if (len > room - w) return codecResult(r, w, CodecStatus::NoRoom);
+    if (o) putUtf8(o + w, len, cp);
+    r += used;
+    w += len;
+  }
+  return codecResult(n, w, CodecStatus::Ok);
+}
+
+} // namespace view_detail
+
+/**
+ * @class Hex
+ * @brief Hexadecimal (base16) encoding: "DEADBEEF" <-> {0xDE, 0xAD, 0xBE, 0xEF}.
+ * Decoding accepts either case; encoding writes lower case unless asked.
+ */
+struct Hex {
+  /** @brief Characters encode() writes for n bytes. */
+  static size_t encodedLength(size_t n) { return n * 2; }
+
+  /** @brief Bytes decode() writes for valid text. */
+  static size_t decodedLength(const StringView& text) { return text.length() / 2; }
+
+  /** @brief Writes two digits per byte of data to out. */
+  static CodecResult encode(const MemoryView<uint8_t>& data, const MutableView<char>& out, bool upper = false) {
+    size_t n = data.length();
+    size_t fit = out.length() / 2;
+    size_t m = (n < fit) ? n : fit;
+    const uint8_t* d = data.data();
+    char* o = out.data();
+    const char ten = upper ? 'A' : 'a';
+    for (size_t i = 0; i < m; i++) {
+      o[2 * i] = view_detail::hexDigit((uint8_t)(d[i] >> 4), ten);
+      o[2 * i + 1] = view_detail::hexDigit((uint8_t)(d[i] & 0x0F), ten);
+    }
+    return view_detail::codecResult(m, 2 * m, m == n ? CodecStatus::Ok : CodecStatus::NoRoom);
+  }
+
+  /** @brief Decodes digit pairs into out (out may start at text.data(): see decodeInPlace()). */
+  static CodecResult decode(const StringView& text, const MutableView<uint8_t>& out) {
+    const char* d = text.data();
+    size_t n = text.length();
+    uint8_t* o = out.data();
+    size_t room = out.length();
+    size_t i = 0, w = 0;
+    for (; i + 2 <= n; i += 2) {
+      int hi = view_detail::hexValue(d[i]);
+      int lo = view_detail::hexValue(d[i + 1]);
+      if ((hi | lo) < 0) return view_detail::codecResult(i, w, CodecStatus::Invalid);
+      if (w == room) return view_detail::codecResult(i, w, CodecStatus::NoRoom);
+      o[w++] = (uint8_t)((hi << 4) | lo);
+    }
+    if (i < n)
+      return view_detail::codecResult(i, w, view_detail::hexValue(d[i]) < 0 ? CodecStatus::Invalid
+                                                                           : CodecStatus::Incomplete);
+    return view_detail::codecResult(n, w, CodecStatus::Ok);
+  }
+
+  /** @brief Decodes text over itself; the bytes start at text.data(). */
+  static CodecResult decodeInPlace(const MutableStringView& text) {
+    return decode(text, MutableView<uint8_t>(reinterpret_cast<uint8_t*>(text.data()), text.length()));
+  }
+};
+
+/**
+ * @class Base64
+ * @brief Base64 (RFC 4648) with the standard or URL-safe alphabet.
+ *
+ * Decoding looks four characters up in a 256-byte flash table and checks
+ * them with a single test, accepts both alphabets, and accepts input with
+ * or without '=' padding. Line breaks are not skipped: split MIME text into
+ * lines first. For streaming, pass final = false so a trailing group of
+ * fewer than four characters is left for the next chunk.
+ */
+struct Base64 {
+  /** @brief Characters encode() writes for n bytes (no padding when urlSafe). */
+  static size_t encodedLength(size_t n, bool urlSafe = false) {
+    return urlSafe ? (n / 3) * 4 + ((n % 3) ? n % 3 + 1 : 0) : ((n + 2) / 3) * 4;
+  }
+
+  /** @brief Bytes decode() writes for valid text. */
+  static size_t decodedLength(const StringView& text) {
+    size_t n = stripPadding(text);
+    return (n / 4) * 3 + ((n % 4) ? n % 4 - 1 : 0);
+  }
+
+  /**
+   * @brief Encodes data to out. With urlSafe, '-' and '_' replace '+' and
+   * '/' and no padding is written (JWT, URLs and file names).
+   */
+  static CodecResult encode(const MemoryView<uint8_t>& data, const MutableView<char>& out, bool urlSafe = false) {
+    const char* table = urlSafe ? view_detail::base64Alphabet<true>() : view_detail::base64Alphabet<false>();
+    const uint8_t* d = data.data();
+    size_t n = data.length();
+    char* o = out.data();
+    size_t room = out.length();
+    size_t i = 0, w = 0;
+    for (; i + 3 <= n; i += 3, w += 4) {
+      if (room - w < 4) return view_detail::codecResult(i, w, CodecStatus::NoRoom);
+      uint32_t v = ((uint32_t)d[i] << 16) | ((uint32_t)d[i + 1] << 8) | d[i + 2];
+      o[w] = (char)VIEWS_FLASH_BYTE(table + (v >> 18));
+      o[w + 1] = (char)VIEWS_FLASH_BYTE(table + ((v >> 12) & 0x3F));
+      o[w + 2] = (char)VIEWS_FLASH_BYTE(table + ((v >> 6) & 0x3F));
+      o[w + 3] = (char)VIEWS_FLASH_BYTE(table + (v & 0x3F));
+    }
+    size_t rem = n - i;
+    if (rem) {
+      size_t chars = urlSafe ? rem + 1 : 4;
+      if (room - w < chars) return view_detail::codecResult(i, w, CodecStatus::NoRoom);
+      uint32_t v = ((uint32_t)d[i] << 16) | ((rem == 2) ? (uint32_t)d[i + 1] << 8 : 0);
+      o[w] = (char)VIEWS_FLASH_BYTE(table + (v >> 18));
+      o[w + 1] = (char)VIEWS_FLASH_BYTE(table + ((v >> 12) & 0x3F));
+      o[w + 2] = (rem == 2) ? (char)VIEWS_FLASH_BYTE(table + ((v >> 6) & 0x3F)) : '=';
+      if (chars == 4) o[w + 3] = '=';
+      w += chars;
+    }
+    return view_detail::codecResult(n, w, CodecStatus::Ok);
+  }
+
+  /** @brief Decodes text into out (out may start at text.data(): see decodeInPlace()). */
+  static CodecResult decode(const StringView& text, const MutableView<uint8_t>& out, bool final = true) {
+    typedef view_detail::FlashTable<uint8_t, view_detail::Base64DecodeGen,
+                                    view_detail::MakeIndexSeq<256>::type> Table;
+    const uint8_t* t = Table::data();
+    const uint8_t* d = reinterpret_cast<const uint8_t*>(text.data());
+    size_t n = text.length();
+    size_t end = stripPadding(text);
+    uint8_t* o = out.data();
+    size_t room = out.length();
+    size_t i = 0, w = 0;
+    for (; i + 4 <= end; i += 4) {
+      uint8_t a = VIEWS_FLASH_BYTE(t + d[i]), b = VIEWS_FLASH_BYTE(t + d[i + 1]);
+      uint8_t c = VIEWS_FLASH_BYTE(t + d[i + 2]), e = VIEWS_FLASH_BYTE(t + d[i + 3]);
+      if ((a | b | c | e) & 0x80) return view_detail::codecResult(i, w, CodecStatus::Invalid);
+      if (room - w < 3) return view_detail::codecResult(i, w, CodecStatus::NoRoom);
+      uint32_t v = ((uint32_t)a << 18) | ((uint32_t)b << 12) | ((uint32_t)c << 6) | e;
+      o[w] = (uint8_t)(v >> 16);
+      o[w + 1] = (uint8_t)(v >> 8);
+      o[w + 2] = (uint8_t)v;
+      w += 3;
+    }
+    size_t rem = end - i;
+    size_t padding = n - end;
+    if (rem == 0) return view_detail::codecResult(i, w, padding ? CodecStatus::Invalid : CodecStatus::Ok);
+    if (padding ? rem + padding != 4 : (rem == 1 && final))
+      return view_detail::codecResult(i, w, CodecStatus::Invalid);
+    if (!padding && !final) return view_detail::codecResult(i, w, CodecStatus::Incomplete);
+    uint8_t a = VIEWS_FLASH_BYTE(t + d[i]), b = VIEWS_FLASH_BYTE(t + d[i + 1]);
+    uint8_t c = (rem == 3) ? VIEWS_FLASH_BYTE(t + d[i + 2]) : 0;
+    if ((a | b | c) & 0x80) return view_detail::codecResult(i, w, CodecStatus::Invalid);
+    if (room - w < rem - 1) return view_detail::codecResult(i, w, CodecStatus::NoRoom);
+    uint32_t v = ((uint32_t)a << 18) | ((uint32_t)b << 12) | ((uint32_t)c << 6);
+    o[w++] = (uint8_t)(v >> 16);
+    if (rem == 3) o[w++] = (uint8_t)(v >> 8);
+    return view_detail::codecResult(n, w, CodecStatus::Ok);
+  }
+
+  /** @brief Decodes text over itself; the bytes start at text.data(). */
+  static CodecResult decodeInPlace(const MutableStringView& text) {
+    return decode(text, MutableView<uint8_t>(reinterpret_cast<uint8_t*>(text.data()), text.length()));
+  }
+
+private:
+  /** @brief Length without up to two trailing '='. */
+  static size_t stripPadding(const StringView& text) {
+    size_t n = text.length();
+    for (uint8_t k = 0; k < 2 && n && text[n - 1] == '='; k++) n--;
+    return n;
+  }
+};
+
+/**
+ * @class Url
+ * @brief Percent-encoding of URL components and form bodies ("a%20b",
+ * "a+b"). Encoding keeps only the RFC 3986 unreserved characters
+ * (letters, digits, "-._~") and writes upper-case escapes.
+ */
+struct Url {
+  /** @brief Characters encode() writes for text. */
+  static size_t encodedLength(const StringView& text, bool spaceAsPlus = false) {
+    size_t n = 0;
+    for (size_t i = 0; i < text.length(); i++)
+      n += (isUnreserved(text[i]) || (spaceAsPlus && text[i] == ' ')) ? 1 : 3;
+    return n;
+  }
+
+  /** @brief Characters decode() writes for valid text. */
+  static size_t decodedLength(const StringView& text) {
+    size_t escapes = 0;
+    for (size_t i = 0; i < text.length(); i++) escapes += (text[i] == '%') ? 1 : 0;
+    return (text.length() > 2 * escapes) ? text.length() - 2 * escapes : 0;
+  }
+
+  /** @brief Percent-encodes text; spaceAsPlus writes ' ' as '+' (form bodies). */
+  static CodecResult encode(const StringView& text, const MutableView<char>& out, bool spaceAsPlus = false) {
+    char* o = out.data();
+    size_t room = out.length();
+    size_t n = text.length();
+    size_t w = 0;
+    for (size_t i = 0; i < n; i++) {
+      uint8_t c = (uint8_t)text[i];
+      if (isUnreserved((char)c) || (spaceAsPlus && c == ' ')) {
+        if (w == room) return view_detail::codecResult(i, w, CodecStatus::NoRoom);
+        o[w++] = (c == ' ') ? '+' : (char)c;
+      } else {
+        if (room - w < 3) return view_detail::codecResult(i, w, CodecStatus::NoRoom);
+        o[w] = '%';
+        o[w + 1] = view_detail::hexDigit((uint8_t)(c >> 4), 'A');
+        o[w + 2] = view_detail::hexDigit((uint8_t)(c & 0x0F), 'A');
+        w += 3;
+      }
+    }
+    return view_detail::codecResult(n, w, CodecStatus::Ok);
+  }
+
+  /**
+   * @brief Decodes %XX escapes (and '+' as space when plusAsSpace, as in
+   * query strings and form bodies) into out; out may start at text.data().
+   * Runs without escapes are copied with one memmove.
+   */
+  static CodecResult decode(const StringView& text, const MutableView<char>& out, bool plusAsSpace = true) {
+    const char* d = text.data();
+    size_t n = text.length();
+    char* o = out.data();
+    size_t room = out.length();
+    size_t r = 0, w = 0;
+    while (r < n) {
+      size_t hit = plusAsSpace
+        ? view_detail::findEitherByte(reinterpret_cast<const uint8_t*>(d + r), n - r, '%', '+')
+        : view_detail::findByte(reinterpret_cast<const uint8_t*>(d + r), n - r, '%');
+      size_t run = (hit == view_detail::kNotFound) ? n - r : hit;
+      if (run > room - w) {
+        if (room > w) memmove(o + w, d + r, room - w);
+        return view_detail::codecResult(r + (room - w), room, CodecStatus::NoRoom);
+      }
+      if (run) memmove(o + w, d + r, run);
+      r += run;
+      w += run;
+      if (r == n) break;
+      if (w == room) return view_detail::codecResult(r, w, CodecStatus::NoRoom);
+      if (d[r] == '+') {
+        o[w++] = ' ';
+        r++;
+        continue;
+      }
+      int hi = (r + 1 < n) ? view_detail::hexValue(d[r + 1]) : 0;
+      int lo = (r + 2 < n) ? view_detail::hexValue(d[r + 2]) : 0;
+      if ((hi | lo) < 0) return view_detail::codecResult(r, w, CodecStatus::Invalid);
+      if (r + 2 >= n) return view_detail::codecResult(r, w, CodecStatus::Incomplete);
+      o[w++] = (char)((hi << 4) | lo);
+      r += 3;
+    }
+    return view_detail::codecResult(n, w, CodecStatus::Ok);
+  }
+
+  /** @brief Decodes text over itself; the result starts at text.data(). */
+  static CodecResult decodeInPlace(const MutableStringView& text, bool plusAsSpace = true) {
+    return decode(text, text.chars(), plusAsSpace);
+  }
+
+private:
+  static bool isUnreserved(char c) {
+    return view_detail::isDigit(c) || (uint8_t)((c | 0x20) - 'a') < 26 || c == '-' || c == '.' ||
+           c == '_' || c == '~';
+  }
+};
+
+/**
+ * @class JsonString
+ * @brief Escaping and unescaping of JSON string contents (without the
+ * quotes). \\uXXXX escapes, including surrogate pairs, become UTF-8, and
+ * unpaired surrogates become U+FFFD (EF BF BD), so the output is always
+ * valid UTF-8 where the input is.
+ */
+struct JsonString {
+  /** @brief Characters escape() writes for text. */
+  static size_t escapedLength(const StringView& text) {
+    size_t n = 0;
+    for (size_t i = 0; i < text.length(); i++) n += escapeLength((uint8_t)text[i]);
+    return n;
+  }
+
+  /** @brief Bytes unescape() writes for text (up to the first invalid escape). */
+  static size_t unescapedLength(const StringView& text) {
+    return view_detail::jsonUnescape(text.data(), text.length(), nullptr, (size_t)-1, true).written;
+  }
+
+  /**
+   * @brief Escapes '"', '\\' and control characters (\\n, \\t, ... or
+   * \\u00XX). Other bytes, including UTF-8 sequences, are copied.
+   */
+  static CodecResult escape(const StringView& text, const MutableView<char>& out) {
+    char* o = out.data();
+    size_t room = out.length();
+    size_t n = text.length();
+    size_t w = 0;
+    for (size_t i = 0; i < n; i++) {
+      uint8_t c = (uint8_t)text[i];
+      uint8_t len = escapeLength(c);
+      if (len > room - w) return view_detail::codecResult(i, w, CodecStatus::NoRoom);
+      if (len == 1) {
+        o[w++] = (char)c;
+        continue;
+      }
+      o[w] = '\\';
+      char named = (c == '"') ? '"' : (c == '\\') ? '\\' : (c == '\b') ? 'b' : (c == '\f') ? 'f'
+                  : (c == '\n') ? 'n' : (c == '\r') ? 'r' : (c == '\t') ? 't' : 0;
+      if (named) {
+        o[w + 1] = named;
+      } else {
+        memcpy(o + w + 1, "u00", 3);
+        o[w + 4] = view_detail::hexDigit((uint8_t)(c >> 4), 'a');
+        o[w + 5] = view_detail::hexDigit((uint8_t)(c & 0x0F), 'a');
+      }
+      w += len;
+    }
+    return view_detail::codecResult(n, w, CodecStatus::Ok);
+  }
+
+  /**
+   * @brief Decodes escapes into out; out may start at text.data(). A high
+   * surrogate so close to the end that its pair may be in the next chunk
+   * is left unconsumed (Incomplete); pass final = true when text is the
+   * whole string, so it becomes U+FFFD instead.
+   */
+  static CodecResult unescape(const StringView& text, const MutableView<char>& out, bool final = false) {
+    return view_detail::jsonUnescape(text.data(), text.length(), out.data(), out.length(), final);
+  }
+
+  /** @brief Unescapes text over itself; the result starts at text.data(). */
+  static CodecResult unescapeInPlace(const MutableStringView& text, bool final = false) {
+    return unescape(text, text.chars(), final);
+  }
+
+private:
+  static uint8_t escapeLength(uint8_t c) {
+    if (c == '"' || c == '\\' || c == '\b' || c == '\f' || c == '\n' || c == '\r' || c == '\t') return 2;
+    return (c < 0x20) ? 6 : 1;
+  }
+};
+
+#endif
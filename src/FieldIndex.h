@@ -0,0 +1,197 @@
+#ifndef FIELD_INDEX_H
+#define FIELD_INDEX_H
+
+#include "Views.h"
+
+namespace view_detail {
+
+#if VIEWS_USE_SWAR
+/** @brief Loads a word with the byte at the lowest address least significant. */
+inline Word loadWordLE(const uint8_t* p) {
+  Word w = loadWord(p);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#if UINTPTR_MAX > 0xFFFFFFFFu
+  w = __builtin_bswap64(w);
+#else
+  w = __builtin_bswap32(w);
+#endif
+#endif
+  return w;
+}
+
+/** @brief Byte index of the lowest 0x80 flag in a non-zero byteEqualMask result. */
+inline size_t lowestMarkedByte(Word mask) {
+  return (size_t)__builtin_ctzll((unsigned long long)mask) >> 3;
+}
+
+/** @brief XOR of all bytes of w. */
+inline uint8_t foldXor(Word w) {
+  for (size_t shift = sizeof(Word) * 4; shift >= 8; shift >>= 1) w ^= w >> shift;
+  return (uint8_t)w;
+}
+#endif
+
+} // namespace view_detail
+
+/**
+ * @class FieldIndex
+ * @brief Splits a line (CSV record, NMEA sentence) in one pass and records
+ * where every field ends, so field(i) is O(1) afterwards instead of a
+ * nextToken() rescan from the start.
+ * @tparam MaxFields Fields recorded (1 to 255). Extra fields stay in the last
+ *         one and isTruncated() is set.
+ *
+ * Delimiters are found a word at a time (VIEWS_USE_SWAR). Offsets are stored
+ * as uint16_t, so lines are limited to 65535 characters. The fields point
+ * into the indexed text, which must outlive the index.
+ *
+ * @code
+ * FieldIndex<20> gga;
+ * if (gga.parseNmea(line) && gga.field(0) == "GPGGA")
+ *   satellites = gga.field(7).toLong();
+ * @endcode
+ */
+template<size_t MaxFields>
+class FieldIndex {
+  static_assert(MaxFields >= 1 && MaxFields <= 255, "FieldIndex holds 1 to 255 fields");
+
+public:
+  /** @brief Creates an empty index. */
+  FieldIndex() : _count(0), _flags(0) {}
+
+  /** @brief Indexes line by delimiter (see split()). */
+  explicit FieldIndex(const StringView& line, char delim = ',') { split(line, delim); }
+
+  // --- Indexing ---
+
+  /**
+   * @brief Indexes the fields of line separated by delim. "a,,b" has three
+   * fields, the middle one empty; an empty line has one empty field.
+   * @return Number of fields recorded.
+   */
+  size_t split(const StringView& line, char delim = ',') {
+    _flags = 0;
+    index(line, delim);
+    return _count;
+  }
+
+  /**
+   * @brief Indexes an NMEA 0183 sentence such as "$GPGGA,...*47\r\n" and
+   * verifies its checksum in the same pass: the XOR of the characters
+   * between '$' (or '!') and '*' must equal the two hex digits after '*'.
+   * Fields exclude the start character and the checksum; field(0) is the
+   * talker and sentence type.
+   * @return True if the sentence has a checksum and it matches.
+   */
+  bool parseNmea(const StringView& sentence) {
+    _flags = 0;
+    StringView s = sentence.trim();
+    if (!s.isEmpty() && (s[0] == '$' || s[0] == '!')) s = s.slice(1);
+    int star = s.lastIndexOf('*');
+    uint8_t expected = 0;
+    if (star != -1 && s.length() - (size_t)star == 3) {
+      ParseResult<uint8_t> hex = StringView(s.slice(star + 1)).parseHex<uint8_t>();
+      if (hex.ok() && hex.consumed == 2) {
+        expected = hex.value;
+        _flags |= kHasChecksum;
+        s = s.slice(0, star);
+      }
+    }
+    uint8_t sum = index(s, ',');
+    if ((_flags & kHasChecksum) && sum == expected) _flags |= kChecksumOk;
+    return checksumOk();
+  }
+
+  // --- Access ---
+
+  /** @brief Field i, or an empty view if i >= count(). */
+  StringView field(size_t i) const {
+    if (i >= _count) return StringView();
+    size_t start = (i == 0) ? 0 : (size_t)_ends[i - 1] + 1;
+    return StringView(_line.data() + start, _ends[i] - start);
+  }
+
+  /** @brief Same as field(i). */
+  StringView operator[](size_t i) const { return field(i); }
+
+  /** @brief Number of fields recorded. */
+  size_t count() const { return _count; }
+
+  /** @brief The indexed text (for NMEA, without start character and checksum). */
+  StringView line() const { return _line; }
+
+  /** @brief True if there were more than MaxFields fields or the line was cut at 65535. */
+  bool isTruncated() const { return (_flags & kTruncated) != 0; }
+
+  /** @brief True if the last parseNmea() found a "*hh" checksum. */
+  bool hasChecksum() const { return (_flags & kHasChecksum) != 0; }
+
+  /** @brief True if the last parseNmea() found a matching checksum. */
+  bool checksumOk() const { return (_flags & kChecksumOk) != 0; }
+
+private:
+  enum : uint8_t { kTruncated = 1, kHasChecksum = 2, kChecksumOk = 4 };
+
+  /** @brief Records delimiter positions; returns the XOR of all characters. */
+  uint8_t index(const StringView& text, char delim) {
+    size_t n = text.length();
+    if (n > 0xFFFF) {
+      n = 0xFFFF;
+      _flags |= kTruncated;
+    }
+    _line = StringView(text.data(), n);
+    _count = 0;
+    const uint8_t* d = reinterpret_cast<const uint8_t*>(text.data());
+    const uint8_t v = (uint8_t)delim;
+    const size_t last = MaxFields - 1;  // delimiters that can be recorded
+    bool full = (last == 0);
+    uint8_t sum = 0;
+    size_t i = 0;
+#if VIEWS_USE_SWAR
+    using namespace view_detail;
+    for (; i < n && !isWordAligned(d + i); i++) sum ^= mark(d, i, v, full);
+    const Word pattern = kLowBits * v;
+    Word acc = 0;
+    for (; i + sizeof(Word) <= n; i += sizeof(Word)) {
+      Word w = loadWord(d + i);
+      acc ^= w;
+      if (full) {
+        if (hasByte(w, pattern)) _flags |= kTruncated;
+        continue;
+      }
+      for (Word m = byteEqualMask(loadWordLE(d + i), pattern); m; m &= m - 1) {
+        if (_count == last) {
+          _flags |= kTruncated;
+          break;
+        }
+        _ends[_count++] = (uint16_t)(i + lowestMarkedByte(m));
+      }
+      full = (_count == last);
+    }
+    sum ^= foldXor(acc);
+#endif
+    for (; i < n; i++) sum ^= mark(d, i, v, full);
+    _ends[_count++] = (uint16_t)n;
+    return sum;
+  }
+
+  /** @brief Byte-at-a-time step: records d[i] if it is a delimiter; returns d[i]. */
+  uint8_t mark(const uint8_t* d, size_t i, uint8_t v, bool& full) {
+    if (d[i] == v) {
+      if (full) {
+        _flags |= kTruncated;
+      } else {
+        _ends[_count++] = (uint16_t)i;
+        full = (_count == MaxFields - 1);
+      }
+    }
+    return d[i];
+  }
+
+  StringView _line;
+  uint16_t _ends[MaxFields]; ///< Offset one past the end of each field.
+  uint8_t _count;
+  uint8_t _flags;
+};
+
+#endif
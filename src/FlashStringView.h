@@ -0,0 +1,197 @@
+#ifndef FLASH_STRING_VIEW_H
+#define FLASH_STRING_VIEW_H
+
+#include "Views.h"
+
+/** @brief Bytes copied through the stack per write when printing. */
+#ifndef VIEWS_FLASH_PRINT_CHUNK
+#define VIEWS_FLASH_PRINT_CHUNK 16
+#endif
+
+/**
+ * @brief FlashStringView over a string literal, with its length from the
+ * compiler (no strlen_P). Like F(), usable only inside functions.
+ */
+#define VIEWS_F(literal) FlashStringView(PSTR(literal), sizeof(literal) - 1)
+
+/**
+ * @class FlashStringView
+ * @brief A read-only window into text stored in program memory (PROGMEM).
+ *
+ * The pointer is a flash address and is never dereferenced directly; every
+ * access goes through the pgm_read / _P functions. Compare against, and
+ * search in, RAM StringViews without copying the text into SRAM.
+ */
+class FlashStringView : public Printable {
+public:
+  /** @brief Default constructor creating an empty view. */
+  FlashStringView() : _data(nullptr), _len(0) {}
+
+  /** @brief Constructs a view from a PROGMEM pointer and a length. */
+  FlashStringView(const char* progmem, size_t len) : _data(progmem), _len(len) {}
+
+  /** @brief Constructs a view from F("...") (uses strlen_P). */
+  FlashStringView(const __FlashStringHelper* s)
+    : _data(reinterpret_cast<const char*>(s)),
+      _len(s ? VIEWS_FLASH_STRLEN(reinterpret_cast<const char*>(s)) : 0) {}
+
+  /**
+   * @brief Constructs a view over a whole PROGMEM char array, e.g.
+   * `const char kTopic[] PROGMEM = "...";`. The terminator is excluded.
+   */
+  template<size_t N>
+  explicit FlashStringView(const char (&progmem)[N]) : _data(progmem), _len(N - 1) {}
+
+  // --- Accessors ---
+
+  /** @brief Flash address of the first character (read with pgm_read_byte). */
+  const char* data() const { return _data; }
+
+  /** @brief Number of characters. */
+  size_t length() const { return _len; }
+
+  /** @brief Returns true if the length is 0. */
+  bool isEmpty() const { return _len == 0; }
+
+  /** @brief Reads one character from flash. */
+  char operator[](size_t index) const { return (char)VIEWS_FLASH_BYTE(_data + index); }
+
+  /** @brief Creates a sub-window (same rules as MemoryView::slice). */
+  FlashStringView slice(size_t start, size_t length = 0xFFFFFFFF) const {
+    if (start >= _len) return FlashStringView();
+    size_t avail = _len - start;
+    return FlashStringView(_data + start, (length > avail) ? avail : length);
+  }
+
+  /** @brief The same address as F(), for APIs that take __FlashStringHelper. */
+  const __FlashStringHelper* asFlashString() const {
+    return reinterpret_cast<const __FlashStringHelper*>(_data);
+  }
+
+  // --- Comparison ---
+
+  /** @brief Content equality with RAM text. */
+  bool equals(const StringView& other) const {
+    return other.length() == _len && VIEWS_FLASH_CMP(other.data(), _data, _len) == 0;
+  }
+
+  /** @brief Content equality with other flash text. */
+  bool equals(const FlashStringView& other) const {
+    if (other._len != _len) return false;
+    char buf[VIEWS_FLASH_PRINT_CHUNK];
+    for (size_t i = 0; i < _len; i += sizeof(buf)) {
+      size_t n = (_len - i < sizeof(buf)) ? _len - i : sizeof(buf);
+      VIEWS_FLASH_READ(buf, other._data + i, n);
+      if (VIEWS_FLASH_CMP(buf, _data + i, n) != 0) return false;
+    }
+    return true;
+  }
+
+  /** @brief Checks whether the flash text begins with a RAM prefix. */
+  bool startsWith(const StringView& prefix) const {
+    return prefix.length() <= _len && VIEWS_FLASH_CMP(prefix.data(), _data, prefix.length()) == 0;
+  }
+
+  // --- Search ---
+
+  /** @brief Finds a character in the flash text; -1 if not found. */
+  int indexOf(char c, size_t from = 0) const {
+    for (size_t i = from; i < _len; i++)
+      if ((char)VIEWS_FLASH_BYTE(_data + i) == c) return (int)i;
+    return -1;
+  }
+
+  /** @brief Finds RAM text in the flash text; -1 if not found. */
+  int indexOf(const StringView& pattern, size_t from = 0) const {
+    size_t m = pattern.length();
+    if (m == 0 || from > _len || m > _len - from) return -1;
+    char first = pattern[0];
+    for (size_t i = from; i + m <= _len; i++) {
+      if ((char)VIEWS_FLASH_BYTE(_data + i) == first &&
+          VIEWS_FLASH_CMP(pattern.data() + 1, _data + i + 1, m - 1) == 0)
+        return (int)i;
+    }
+    return -1;
+  }
+
+  /**
+   * @brief Finds this flash text inside a RAM view; -1 if not found.
+   * memchr locates candidates for the first character, memcmp_P verifies.
+   */
+  int findIn(const StringView& haystack, size_t from = 0) const {
+    size_t n = haystack.length();
+    if (_len == 0 || from > n || _len > n - from) return -1;
+    const char* h = haystack.data();
+    char first = (*this)[0];
+    for (size_t i = from, last = n - _len; i <= last;) {
+      const char* hit = (const char*)memchr(h + i, first, last - i + 1);
+      if (!hit) return -1;
+      i = (size_t)(hit - h);
+      if (VIEWS_FLASH_CMP(hit + 1, _data + 1, _len - 1) == 0) return (int)i;
+      i++;
+    }
+    return -1;
+  }
+
+  // --- Conversion & Output ---
+
+  /**
+   * @brief Copies the text to RAM (no terminator).
+   * @return Characters copied (truncated to capacity).
+   */
+  size_t copyTo(char* dst, size_t capacity) const {
+    size_t n = (_len < capacity) ? _len : capacity;
+    if (n) VIEWS_FLASH_READ(dst, _data, n);
+    return n;
+  }
+
+  /** @brief Printable interface; streams through a small stack buffer. */
+  size_t printTo(Print& p) const override {
+    char buf[VIEWS_FLASH_PRINT_CHUNK];
+    size_t written = 0;
+    for (size_t i = 0; i < _len; i += sizeof(buf)) {
+      size_t n = (_len - i < sizeof(buf)) ? _len - i : sizeof(buf);
+      VIEWS_FLASH_READ(buf, _data + i, n);
+      written += p.write(reinterpret_cast<const uint8_t*>(buf), n);
+    }
+    return written;
+  }
+
+private:
+  const char* _data;
+  size_t _len;
+};
+
+inline bool operator==(const FlashStringView& lhs, const StringView& rhs) { return lhs.equals(rhs); }
+inline bool operator==(const StringView& lhs, const FlashStringView& rhs) { return rhs.equals(lhs); }
+inline bool operator==(const FlashStringView& lhs, const FlashStringView& rhs) { return lhs.equals(rhs); }
+
+// F("...") converts to both String and FlashStringView; these pick the latter.
+inline bool operator==(const StringView& lhs, const __FlashStringHelper* rhs) {
+  return FlashStringView(rhs).equals(lhs);
+}
+inline bool operator==(const __FlashStringHelper* lhs, const StringView& rhs) {
+  return FlashStringView(lhs).equals(rhs);
+}
+
+// --- StringView members with flash operands ---
+
+inline int StringView::indexOf(const FlashStringView& pattern, size_t from) const {
+  return pattern.findIn(*this, from);
+}
+
+inline bool StringView::contains(const FlashStringView& pattern) const {
+  return pattern.findIn(*this) != -1;
+}
+
+inline bool StringView::contains(const __FlashStringHelper* pattern) const {
+  return FlashStringView(pattern).findIn(*this) != -1;
+}
+
+inline bool StringView::equals(const FlashStringView& other) const { return other.equals(*this); }
+
+inline bool StringView::startsWith(const FlashStringView& prefix) const {
+  return prefix.length() <= _len && VIEWS_FLASH_CMP(_data, prefix.data(), prefix.length()) == 0;
+}
+
+#endif
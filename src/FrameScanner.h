@@ -0,0 +1,300 @@
+#ifndef FRAME_SCANNER_H
+#define FRAME_SCANNER_H
+
+#include "Views.h"
+#include "ByteReader.h"
+
+/** @brief Longest delimiter FrameScanner accepts in Framing::Delimited mode. */
+#ifndef VIEWS_FRAME_MAX_DELIMITER
+#define VIEWS_FRAME_MAX_DELIMITER 8
+#endif
+
+/** @brief How FrameScanner finds frame boundaries. */
+enum class Framing : uint8_t {
+  Delimited,      ///< Frames end with a delimiter sequence (default "\n").
+  LengthPrefixed, ///< Each frame starts with a 1, 2 or 4-byte payload length.
+  Slip,           ///< RFC 1055 SLIP: END (0xC0) terminated, ESC (0xDB) escaped.
+  Cobs            ///< Consistent Overhead Byte Stuffing, 0x00 terminated.
+};
+
+/**
+ * @class FrameScanner
+ * @brief Reassembles frames from fragments (Serial, WiFiClient, DMA chunks)
+ * in a caller-supplied buffer, scanning every byte only once.
+ *
+ * The scanner remembers how far it has searched and, for multi-byte
+ * delimiters, how much of the delimiter the buffered tail already matched,
+ * so feeding a long message in small pieces stays O(n). Complete frames are
+ * returned as views into the buffer (SLIP and COBS are decoded in place).
+ *
+ * Drain next() until it returns false before the next feed(): feeding
+ * compacts the buffer, which invalidates the frames returned so far.
+ */
+class FrameScanner {
+public:
+  /** @brief Buffers fragments in buffer[0, capacity); the largest frame must fit. */
+  FrameScanner(uint8_t* buffer, size_t capacity, Framing framing = Framing::Delimited)
+    : _buf(buffer), _cap(capacity), _start(0), _scan(0), _len(0), _framing(framing),
+      _match(0), _prefixBytes(2), _endian(Endian::Big), _discard(false), _overflow(false),
+      _errors(0) {
+    setDelimiter(StringView("\n"));
+  }
+
+  /** @brief Buffers fragments in a fixed-size array. */
+  template<size_t N>
+  FrameScanner(uint8_t (&buffer)[N], Framing framing = Framing::Delimited)
+    : FrameScanner(buffer, N, framing) {}
+
+  // --- Configuration ---
+
+  /**
+   * @brief Delimiter for Framing::Delimited (1 to VIEWS_FRAME_MAX_DELIMITER
+   * bytes, e.g. "\r\n").
+   * @return False, keeping the previous delimiter, if delimiter is empty or
+   *         longer than VIEWS_FRAME_MAX_DELIMITER.
+   */
+  bool setDelimiter(const StringView& delimiter) {
+    size_t n = delimiter.length();
+    if (n == 0 || n > VIEWS_FRAME_MAX_DELIMITER) return false;
+    memcpy(_delim, delimiter.data(), n);
+    _delimLen = (uint8_t)n;
+    // KMP failure function: longest proper prefix that is also a suffix.
+    _fail[0] = 0;
+    for (uint8_t i = 1, k = 0; i < n; i++) {
+      while (k > 0 && _delim[i] != _delim[k]) k = _fail[k - 1];
+      if (_delim[i] == _delim[k]) k++;
+      _fail[i] = k;
+    }
+    _match = 0;
+    return true;
+  }
+
+  /** @brief Header size (1, 2 or 4 bytes) and byte order for Framing::LengthPrefixed. */
+  FrameScanner& setLengthPrefix(uint8_t bytes, Endian endian = Endian::Big) {
+    _prefixBytes = (bytes == 1 || bytes == 4) ? bytes : 2;
+    _endian = endian;
+    return *this;
+  }
+
+  // --- Input ---
+
+  /**
+   * @brief Appends a fragment.
+   * If the buffer is full without a complete frame, the partial frame is
+   * dropped, overflowed() is set and input up to the next boundary is
+   * discarded.
+   * @return Bytes accepted (less than chunk.length() only if the buffer is
+   *         smaller than the fragment).
+   */
+  size_t feed(const MemoryView<uint8_t>& chunk) {
+    size_t room;
+    uint8_t* dst = prepare(room);
+    size_t n = (chunk.length() < room) ? chunk.length() : room;
+    if (n) memcpy(dst, chunk.data(), n);
+    commit(n);
+    return n;
+  }
+
+  /** @brief Appends text (Serial.readStringUntil results, AT responses, ...). */
+  size_t feed(const StringView& chunk) {
+    return feed(chunk.castTo<uint8_t>());
+  }
+
+  /**
+   * @brief Free space for reading directly into the buffer (avoids a copy):
+   * `n = Serial.readBytes(s.prepare(room), room); s.commit(n);`
+   */
+  uint8_t* prepare(size_t& room) {
+    compact();
+    if (_len == _cap) {
+      _overflow = true;
+      _discard = (_framing != Framing::LengthPrefixed);
+      _len = _scan = 0;
+    }
+    room = _cap - _len;
+    return _buf + _len;
+  }
+
+  /** @brief Marks n bytes written after prepare() as received. */
+  void commit(size_t n) { _len += (n < _cap - _len) ? n : _cap - _len; }
+
+  // --- Output ---
+
+  /**
+   * @brief Extracts the next complete frame, if any.
+   * @param frame Receives the payload (delimiter, header or encoding removed).
+   * @return False if no complete frame is buffered yet.
+   */
+  bool next(MemoryView<uint8_t>& frame) {
+    switch (_framing) {
+      case Framing::LengthPrefixed: return nextLengthPrefixed(frame);
+      case Framing::Slip: return nextTerminated(frame, 0xC0);
+      case Framing::Cobs: return nextTerminated(frame, 0x00);
+      default: return nextDelimited(frame);
+    }
+  }
+
+  /** @brief next() for text protocols. */
+  bool next(StringView& frame) {
+    MemoryView<uint8_t> bytes;
+    if (!next(bytes)) return false;
+    frame = bytes.castTo<char>();
+    return true;
+  }
+
+  // --- State ---
+
+  /** @brief Bytes buffered that are not yet part of a returned frame. */
+  size_t buffered() const { return _len - _start; }
+
+  /** @brief True if a frame was dropped because it did not fit. */
+  bool overflowed() const { return _overflow; }
+
+  /** @brief Frames dropped for invalid SLIP/COBS encoding or oversize length. */
+  uint16_t errors() const { return _errors; }
+
+  /** @brief Discards all buffered input and clears the flags. */
+  void reset() {
+    _start = _scan = _len = 0;
+    _match = 0;
+    _discard = _overflow = false;
+    _errors = 0;
+  }
+
+private:
+  /** @brief Moves unconsumed bytes to the front of the buffer. */
+  void compact() {
+    if (_start == 0) return;
+    size_t n = _len - _start;
+    if (n) memmove(_buf, _buf + _start, n);
+    _scan -= _start;
+    _len = n;
+    _start = 0;
+  }
+
+  /** @brief Consumes bytes up to end; returns false if the frame was being discarded. */
+  bool finish(size_t end) {
+    _start = _scan = end;
+    bool keep = !_discard;
+    _discard = false;
+    return keep;
+  }
+
+  bool nextDelimited(MemoryView<uint8_t>& frame) {
+    size_t i = _scan;
+    while (i < _len) {
+      if (_match == 0) {
+        const uint8_t* hit = (const uint8_t*)memchr(_buf + i, _delim[0], _len - i);
+        if (!hit) {
+          i = _len;
+          break;
+        }
+        i = (size_t)(hit - _buf);
+      }
+      uint8_t c = _buf[i++];
+      while (_match > 0 && c != _delim[_match]) _match = _fail[_match - 1];
+      if (c == _delim[_match]) _match++;
+      if (_match == _delimLen) {
+        _match = 0;
+        size_t begin = _start;
+        if (finish(i)) {
+          frame = MemoryView<uint8_t>(_buf + begin, i - _delimLen - begin);
+          return true;
+        }
+      }
+    }
+    _scan = i;
+    return false;
+  }
+
+  bool nextLengthPrefixed(MemoryView<uint8_t>& frame) {
+    size_t avail = _len - _start;
+    if (avail < _prefixBytes) return false;
+    const uint8_t* p = _buf + _start;
+    uint32_t n = (_prefixBytes == 1) ? p[0]
+               : (_prefixBytes == 2) ? view_detail::loadUint<uint16_t>(p, _endian)
+               : view_detail::loadUint<uint32_t>(p, _endian);
+    if (n > _cap - _prefixBytes) {
+      // Cannot be buffered and there is no way to resynchronise.
+      _errors++;
+      _overflow = true;
+      _start = _scan = _len = 0;
+      return false;
+    }
+    if (avail - _prefixBytes < n) return false;
+    frame = MemoryView<uint8_t>(p + _prefixBytes, n);
+    _start = _scan = _start + _prefixBytes + n;
+    return true;
+  }
+
+  /** @brief SLIP/COBS: find the terminator, then decode the frame in place. */
+  bool nextTerminated(MemoryView<uint8_t>& frame, uint8_t end) {
+    while (_scan < _len) {
+      const uint8_t* hit = (const uint8_t*)memchr(_buf + _scan, end, _len - _scan);
+      if (!hit) {
+        _scan = _len;
+        return false;
+      }
+      size_t begin = _start;
+      size_t stop = (size_t)(hit - _buf);
+      if (!finish(stop + 1) || stop == begin) continue;  // discarded or empty
+      size_t n = (_framing == Framing::Slip) ? decodeSlip(_buf + begin, stop - begin)
+                                             : decodeCobs(_buf + begin, stop - begin);
+      if (n == (size_t)-1) {
+        _errors++;
+        continue;
+      }
+      frame = MemoryView<uint8_t>(_buf + begin, n);
+      return true;
+    }
+    return false;
+  }
+
+  /** @brief Unescapes SLIP in place; returns the decoded length or -1. */
+  static size_t decodeSlip(uint8_t* d, size_t n) {
+    size_t w = 0;
+    for (size_t r = 0; r < n; r++) {
+      uint8_t c = d[r];
+      if (c == 0xDB) {
+        if (++r == n) return (size_t)-1;
+        if (d[r] == 0xDC) c = 0xC0;
+        else if (d[r] == 0xDD) c = 0xDB;
+        else return (size_t)-1;
+      }
+      d[w++] = c;
+    }
+    return w;
+  }
+
+  /** @brief Decodes COBS in place (output never overtakes input); length or -1. */
+  static size_t decodeCobs(uint8_t* d, size_t n) {
+    size_t w = 0;
+    for (size_t r = 0; r < n;) {
+      uint8_t code = d[r++];
+      if (code == 0 || (size_t)(code - 1) > n - r) return (size_t)-1;
+      memmove(d + w, d + r, code - 1);
+      w += code - 1;
+      r += code - 1;
+      if (code != 0xFF && r < n) d[w++] = 0;
+    }
+    return w;
+  }
+
+  uint8_t* _buf;
+  size_t _cap;
+  size_t _start; ///< First byte of the frame being assembled.
+  size_t _scan;  ///< Next byte to examine; [_start, _scan) holds no boundary.
+  size_t _len;   ///< Bytes in the buffer.
+  Framing _framing;
+  uint8_t _delim[VIEWS_FRAME_MAX_DELIMITER];
+  uint8_t _fail[VIEWS_FRAME_MAX_DELIMITER];
+  uint8_t _delimLen;
+  uint8_t _match; ///< Delimiter bytes matched by the tail of [_start, _scan).
+  uint8_t _prefixBytes;
+  Endian _endian;
+  bool _discard;
+  bool _overflow;
+  uint16_t _errors;
+};
+
+#endif
@@ -0,0 +1,336 @@
+#ifndef HEADER_PARSER_H
+#define HEADER_PARSER_H
+
+#include "Views.h"
+
+namespace view_detail {
+
+constexpr uint8_t asciiLower(char c) {
+  return (c >= 'A' && c <= 'Z') ? (uint8_t)(c | 0x20) : (uint8_t)c;
+}
+
+/** @brief FNV-1a over the ASCII lower case of s[0, n), usable in constant expressions. */
+constexpr uint32_t fnv1aFolded(const char* s, size_t n, uint32_t h = 2166136261UL) {
+  return n == 0 ? h : fnv1aFolded(s + 1, n - 1, (uint32_t)((h ^ asciiLower(*s)) * 16777619UL));
+}
+
+inline bool isHeaderSpace(char c) { return c == ' ' || c == '\t'; }
+
+} // namespace view_detail
+
+/**
+ * @brief A header name with its case-insensitive hash, made by headerHash().
+ * Converts to the hash; HeaderParser::get() also confirms the name, so a
+ * header whose name merely collides is never returned.
+ */
+struct HeaderKey {
+  uint32_t hash;
+  const char* name;
+  size_t length;
+
+  constexpr HeaderKey(uint32_t h, const char* s, size_t n) : hash(h), name(s), length(n) {}
+  constexpr operator uint32_t() const { return hash; }
+};
+
+namespace view_detail {
+constexpr HeaderKey headerKey(const char* name, size_t n) { return HeaderKey(fnv1aFolded(name, n), name, n); }
+} // namespace view_detail
+
+/**
+ * @brief Case-insensitive hash of a header name, evaluated by the compiler for
+ * literals: `headers.get(headerHash("Content-Length"))`. The name is the text
+ * up to the first NUL (at most N), as for StringView, so char buffers work too.
+ */
+template<size_t N>
+constexpr HeaderKey headerHash(const char (&name)[N]) {
+  return view_detail::headerKey(name, view_detail::cstrnlen(name, N));
+}
+
+/** @brief Case-insensitive hash of a header name at run time (same values). */
+inline uint32_t headerHash(const StringView& name) {
+  uint32_t h = 2166136261UL;
+  for (size_t i = 0; i < name.length(); i++)
+    h = (uint32_t)((h ^ view_detail::foldCase((uint8_t)name[i])) * 16777619UL);
+  return h;
+}
+
+/**
+ * @class HeaderParser
+ * @brief Splits an HTTP request line and "Name: value" header lines into
+ * StringView pairs in a single pass, hashing each name (case-insensitively)
+ * while looking for its colon.
+ * @tparam MaxHeaders Headers recorded; later ones are counted as truncated.
+ *
+ * Values have surrounding spaces and tabs removed. Offsets are stored as
+ * uint16_t (12 bytes per header), so header blocks are limited to 65535
+ * characters. Obsolete folded continuation lines are reported as malformed.
+ * The parsed text must outlive the parser.
+ */
+template<size_t MaxHeaders = 16>
+class HeaderParser {
+  static_assert(MaxHeaders >= 1 && MaxHeaders <= 255, "HeaderParser holds 1 to 255 headers");
+
+public:
+  HeaderParser() : _count(0), _body(0), _complete(false), _truncated(false), _malformed(false) {}
+
+  // --- Parsing ---
+
+  /**
+   * @brief Parses "METHOD target HTTP/x.y" followed by header lines.
+   * @return True if the request line is well formed and the header block
+   *         ended with an empty line.
+   */
+  bool parseRequest(const StringView& text) {
+    reset(text);
+    const char* d = _text.data();
+    size_t n = _text.length();
+    size_t next;
+    size_t end = lineEnd(0, next);
+    int sp1 = StringView(d, end).indexOf(' ');
+    int sp2 = (sp1 == -1) ? -1 : StringView(d, end).indexOf(' ', sp1 + 1);
+    if (sp1 <= 0 || sp2 <= sp1 + 1 || (size_t)sp2 + 1 >= end) {
+      _malformed = true;
+      _body = n;
+      return false;
+    }
+    _method = StringView(d, sp1);
+    _target = StringView(d + sp1 + 1, sp2 - sp1 - 1);
+    _version = StringView(d + sp2 + 1, end - sp2 - 1);
+    return parseHeaders(next) && !_malformed;
+  }
+
+  /**
+   * @brief Parses header lines only (e.g. after the caller read the request
+   * line itself, or multipart part headers).
+   * @return True if the block ended with an empty line.
+   */
+  bool parse(const StringView& text) {
+    reset(text);
+    return parseHeaders(0);
+  }
+
+  // --- Request Line ---
+
+  /** @brief "GET", "POST", ... (empty after parse()). */
+  StringView method() const { return _method; }
+
+  /** @brief Request target as sent, e.g. "/api/led?on=1". */
+  StringView target() const { return _target; }
+
+  /** @brief Target without the query string. */
+  StringView path() const {
+    int q = _target.indexOf('?');
+    return (q == -1) ? _target : StringView(_target.data(), q);
+  }
+
+  /** @brief Query string without the '?' (see QueryString). */
+  StringView query() const {
+    int q = _target.indexOf('?');
+    return (q == -1) ? StringView() : StringView(_target.slice(q + 1));
+  }
+
+  /** @brief "HTTP/1.1". */
+  StringView version() const { return _version; }
+
+  // --- Headers ---
+
+  /** @brief Number of headers recorded. */
+  size_t count() const { return _count; }
+
+  /** @brief Name of header i, as sent. */
+  StringView name(size_t i) const {
+    return (i < _count) ? StringView(_text.data() + _entries[i].name, _entries[i].nameLen) : StringView();
+  }
+
+  /** @brief Value of header i, trimmed. */
+  StringView value(size_t i) const {
+    return (i < _count) ? StringView(_text.data() + _entries[i].value, _entries[i].valueLen) : StringView();
+  }
+
+  /** @brief Index of the first header at or after from with this name (any case); -1 if none. */
+  int indexOf(const StringView& name, size_t from = 0) const {
+    uint32_t h = headerHash(name);
+    for (size_t i = from; i < _count; i++)
+      if (_entries[i].hash == h && this->name(i).equalsIgnoreCase(name)) return (int)i;
+    return -1;
+  }
+
+  /** @brief Value of the named header (any case), or an empty view. */
+  StringView get(const StringView& name) const {
+    int i = indexOf(name);
+    return (i == -1) ? StringView() : value(i);
+  }
+
+  /**
+   * @brief indexOf() with the name hashed at compile time: headers whose
+   * hash differs are skipped without touching their text.
+   */
+  int indexOf(const HeaderKey& key, size_t from = 0) const {
+    StringView name(key.name, key.length);
+    for (size_t i = from; i < _count; i++)
+      if (_entries[i].hash == key.hash && this->name(i).equalsIgnoreCase(name)) return (int)i;
+    return -1;
+  }
+
+  /** @brief Value of the header named by headerHash("..."), or an empty view. */
+  StringView get(const HeaderKey& key) const {
+    int i = indexOf(key);
+    return (i == -1) ? StringView() : value(i);
+  }
+
+  /** @brief True if the named header is present (its value may be empty). */
+  bool has(const StringView& name) const { return indexOf(name) != -1; }
+
+  // --- State ---
+
+  /** @brief True if the block ended with an empty line. */
+  bool isComplete() const { return _complete; }
+
+  /** @brief Offset of the first byte after the empty line (the body). */
+  size_t bodyOffset() const { return _body; }
+
+  /** @brief True if more than MaxHeaders headers were sent or the text was cut at 65535. */
+  bool isTruncated() const { return _truncated; }
+
+  /** @brief True if a line had no name or colon, or the request line was invalid. */
+  bool isMalformed() const { return _malformed; }
+
+private:
+  struct Entry {
+    uint16_t name, nameLen;
+    uint16_t value, valueLen;
+    uint32_t hash;
+  };
+
+  void reset(const StringView& text) {
+    _truncated = text.length() > 0xFFFF;
+    _text = StringView(text.data(), _truncated ? 0xFFFF : text.length());
+    _method = _target = _version = StringView();
+    _count = 0;
+    _complete = _malformed = false;
+  }
+
+  /** @brief End of the line starting at pos (before any CR); next receives the following line. */
+  size_t lineEnd(size_t pos, size_t& next) const {
+    const char* d = _text.data();
+    size_t n = _text.length();
+    const char* nl = (pos < n) ? (const char*)memchr(d + pos, '\n', n - pos) : nullptr;
+    size_t end = nl ? (size_t)(nl - d) : n;
+    next = nl ? end + 1 : n;
+    return (end > pos && d[end - 1] == '\r') ? end - 1 : end;
+  }
+
+  bool parseHeaders(size_t pos) {
+    const char* d = _text.data();
+    size_t n = _text.length();
+    while (pos < n) {
+      size_t next;
+      size_t end = lineEnd(pos, next);
+      if (end == pos) {
+        _complete = true;
+        _body = next;
+        return true;
+      }
+      // Hash the name while looking for the colon.
+      uint32_t h = 2166136261UL;
+      size_t colon = pos;
+      for (; colon < end && d[colon] != ':'; colon++)
+        h = (uint32_t)((h ^ view_detail::foldCase((uint8_t)d[colon])) * 16777619UL);
+      if (colon == end || colon == pos || view_detail::isHeaderSpace(d[pos]) ||
+          view_detail::isHeaderSpace(d[colon - 1])) {
+        _malformed = true;
+      } else if (_count == MaxHeaders) {
+        _truncated = true;
+      } else {
+        size_t v = colon + 1;
+        size_t e = end;
+        while (v < e && view_detail::isHeaderSpace(d[v])) v++;
+        while (e > v && view_detail::isHeaderSpace(d[e - 1])) e--;
+        Entry& entry = _entries[_count++];
+        entry.name = (uint16_t)pos;
+        entry.nameLen = (uint16_t)(colon - pos);
+        entry.value = (uint16_t)v;
+        entry.valueLen = (uint16_t)(e - v);
+        entry.hash = h;
+      }
+      pos = next;
+    }
+    _body = n;
+    return false;
+  }
+
+  StringView _text;
+  StringView _method;
+  StringView _target;
+  StringView _version;
+  Entry _entries[MaxHeaders];
+  uint8_t _count;
+  size_t _body;
+  bool _complete;
+  bool _truncated;
+  bool _malformed;
+};
+
+/**
+ * @class QueryString
+ * @brief Splits "a=1&b=two&flag" (URL query strings and
+ * application/x-www-form-urlencoded bodies) into key/value views.
+ *
+ * Keys and values are returned as sent: percent-escapes and '+' are not
+ * decoded. A leading '?' is ignored, as are empty pairs ("a=1&&b=2").
+ */
+class QueryString {
+public:
+  /** @brief Views the pairs of query (which must outlive this object). */
+  explicit QueryString(const StringView& query)
+    : _query((!query.isEmpty() && query[0] == '?') ? StringView(query.slice(1)) : query), _offset(0) {}
+
+  /**
+   * @brief Reads the next pair. A pair without '=' has an empty value.
+   * @return False when there are no more pairs.
+   */
+  bool next(StringView& key, StringView& value) {
+    size_t n = _query.length();
+    while (_offset < n) {
+      StringView pair = _query.nextToken('&', _offset);
+      if (pair.isEmpty()) continue;
+      int eq = pair.indexOf('=');
+      key = (eq == -1) ? pair : StringView(pair.data(), eq);
+      value = (eq == -1) ? StringView() : StringView(pair.slice(eq + 1));
+      return true;
+    }
+    return false;
+  }
+
+  /** @brief Starts next() from the first pair again. */
+  void rewind() { _offset = 0; }
+
+  /** @brief Value of the first pair with this key (exact match), or an empty view. */
+  StringView get(const StringView& key) const {
+    StringView value;
+    find(key, value);
+    return value;
+  }
+
+  /** @brief True if a pair with this key exists (its value may be empty). */
+  bool has(const StringView& key) const {
+    StringView value;
+    return find(key, value);
+  }
+
+private:
+  bool find(const StringView& key, StringView& value) const {
+    QueryString scan(*this);
+    scan.rewind();
+    StringView k;
+    while (scan.next(k, value))
+      if (k == key) return true;
+    value = StringView();
+    return false;
+  }
+
+  StringView _query;
+  size_t _offset;
+};
+
+#endif
@@ -0,0 +1,323 @@
+#ifndef JSON_TOKENIZER_H
+#define JSON_TOKENIZER_H
+
+#include "Views.h"
+#include "Codecs.h"
+
+/** @brief Deepest object/array nesting JsonTokenizer tracks (at most 32). */
+#ifndef VIEWS_JSON_MAX_DEPTH
+#define VIEWS_JSON_MAX_DEPTH 32
+#endif
+
+/** @brief Kinds of token produced by JsonTokenizer. */
+enum class JsonToken : uint8_t {
+  End,         ///< No more input (or not started).
+  BeginObject, ///< '{'
+  EndObject,   ///< '}'
+  BeginArray,  ///< '['
+  EndArray,    ///< ']'
+  Key,         ///< Object member name; text() is the content between the quotes.
+  String,      ///< String value; text() is the content between the quotes.
+  Number,      ///< Number; text() is the literal, e.g. "-12.5e3".
+  True,
+  False,
+  Null,
+  Error        ///< Malformed input; the tokenizer stays in this state.
+};
+
+/**
+ * @class JsonTokenizer
+ * @brief Pull parser over a StringView: returns one token per next() call as
+ * a type and a slice of the input. Nothing is allocated or copied, strings
+ * are not unescaped until asked (unescaped()), and whole subtrees can be
+ * skipped without tokenizing them.
+ *
+ * @code
+ * JsonTokenizer json(payload);
+ * if (json.findPath("sensors[1].temp") == JsonToken::Number)
+ *   temp = json.text().toFixed(2);
+ * @endcode
+ */
+class JsonTokenizer {
+public:
+  /** @brief Tokenizes json; the text must outlive the tokenizer and its tokens. */
+  explicit JsonTokenizer(const StringView& json)
+    : _json(json), _pos(0), _start(0), _tokLen(0), _type(JsonToken::End), _stack(0), _depth(0),
+      _expect(ExpectValue), _escaped(false) {}
+
+  // --- Pulling Tokens ---
+
+  /** @brief Advances to the next token and returns its type. */
+  JsonToken next() {
+    if (_type == JsonToken::Error) return _type;
+    skipSpace();
+    if (_pos >= _json.length()) {
+      JsonToken t = (_depth == 0 && _expect == ExpectCommaOrEnd) ? JsonToken::End : JsonToken::Error;
+      return setToken(t, _pos, 0);
+    }
+    char c = _json[_pos];
+
+    if (_expect == ExpectCommaOrEnd || _expect == ExpectKeyOrEnd || _expect == ExpectValueOrEnd) {
+      if (c == '}' || c == ']') return closeContainer(c);
+      if (_expect == ExpectCommaOrEnd) {
+        if (_depth == 0 || c != ',') return fail();
+        _pos++;
+        skipSpace();
+        if (_pos >= _json.length()) return fail();
+        c = _json[_pos];
+        _expect = inObject() ? ExpectKey : ExpectValue;
+      } else {
+        _expect = (_expect == ExpectKeyOrEnd) ? ExpectKey : ExpectValue;
+      }
+    }
+
+    if (_expect == ExpectKey) {
+      if (c != '"' || !scanString()) return fail();
+      skipSpace();
+      if (_pos >= _json.length() || _json[_pos] != ':') return fail();
+      _pos++;
+      _expect = ExpectValue;
+      _type = JsonToken::Key;
+      return _type;
+    }
+
+    // A value.
+    _expect = ExpectCommaOrEnd;
+    switch (c) {
+      case '{': return openContainer(true);
+      case '[': return openContainer(false);
+      case '"':
+        if (!scanString()) return fail();
+        _type = JsonToken::String;
+        return _type;
+      case 't': return literal("true", 4, JsonToken::True);
+      case 'f': return literal("false", 5, JsonToken::False);
+      case 'n': return literal("null", 4, JsonToken::Null);
+      default: return number();
+    }
+  }
+
+  /** @brief Type of the current token. */
+  JsonToken type() const { return _type; }
+
+  /**
+   * @brief Slice of the input for the current token: string and key content
+   * without quotes (still escaped), number and literal text, or the bracket.
+   */
+  StringView text() const { return StringView(_json.data() + _start, _tokLen); }
+
+  /** @brief True if the current string or key contains backslash escapes. */
+  bool hasEscapes() const { return _escaped; }
+
+  /** @brief Current nesting depth (1 inside the root object or array). */
+  uint8_t depth() const { return _depth; }
+
+  /** @brief Offset in the input just past the current token. */
+  size_t position() const { return _pos; }
+
+  /** @brief False once malformed input was seen. */
+  bool ok() const { return _type != JsonToken::Error; }
+
+  /**
+   * @brief If the current token opens an object or array, jumps past its
+   * matching close without tokenizing the contents (nothing is validated
+   * until then). After a Key, skips the member's value. Otherwise no-op.
+   * @return False on malformed input.
+   */
+  bool skip() {
+    if (_type == JsonToken::Key) next();
+    if (_type != JsonToken::BeginObject && _type != JsonToken::BeginArray) return ok();
+    size_t n = _json.length();
+    const char* d = _json.data();
+    uint8_t level = 1;
+    while (_pos < n) {
+      char c = d[_pos];
+      if (c == '"') {
+        if (!scanString()) break;
+        continue;
+      }
+      if (c == '{' || c == '[') {
+        if (++level == 0) break;
+      } else if ((c == '}' || c == ']') && --level == 0) {
+        closeContainer(c);
+        return ok();
+      }
+      _pos++;
+    }
+    fail();
+    return false;
+  }
+
+  /**
+   * @brief Descends along a path such as "sensors[1].temp" or "[0].id" and
+   * stops at the value, leaving the tokenizer positioned on it (for an
+   * object or array, further next() calls read its contents).
+   * Members that are not on the path are skipped without tokenizing them.
+   * Keys are compared as written (escapes in keys are not decoded).
+   * @return The value's token type, or JsonToken::End if the path does not
+   *         exist (JsonToken::Error on malformed input).
+   */
+  JsonToken findPath(const StringView& path) {
+    if (_depth == 0 && _expect == ExpectValue) next();  // not started: read the root
+    if (_type == JsonToken::Key) next();
+    size_t i = 0, n = path.length();
+    while (i < n && _type != JsonToken::Error) {
+      if (path[i] == '.' && ++i == n) break;
+      if (path[i] == '[') {
+        ParseResult<uint32_t> index = StringView(path.slice(i + 1)).parseUnsigned<uint32_t>();
+        i += 1 + index.consumed;
+        if (!index.ok() || i >= n || path[i] != ']' || _type != JsonToken::BeginArray)
+          return JsonToken::End;
+        i++;
+        for (uint32_t k = 0;; k++) {
+          JsonToken t = next();
+          if (t == JsonToken::EndArray || t == JsonToken::Error) return notFound();
+          if (k == index.value) break;
+          if (!skip()) return _type;
+        }
+      } else {
+        size_t end = i;
+        while (end < n && path[end] != '.' && path[end] != '[') end++;
+        StringView name(path.data() + i, end - i);
+        i = end;
+        if (_type != JsonToken::BeginObject) return JsonToken::End;
+        for (;;) {
+          JsonToken t = next();
+          if (t != JsonToken::Key) return notFound();
+          bool match = text() == name;
+          next();
+          if (match) break;
+          if (!skip()) return _type;
+        }
+      }
+    }
+    return _type;
+  }
+
+  /**
+   * @brief The current string or key with escapes decoded (\\uXXXX becomes
+   * UTF-8; see JsonString). Without escapes this is text() itself and buf is
+   * not touched; otherwise the result is written to buf and truncated to
+   * capacity, or cut at an invalid escape.
+   */
+  StringView unescaped(char* buf, size_t capacity) const {
+    if (!_escaped) return text();
+    return StringView(buf, JsonString::unescape(text(), MutableView<char>(buf, capacity), true).written);
+  }
+
+private:
+  enum Expect : uint8_t { ExpectValue, ExpectValueOrEnd, ExpectKey, ExpectKeyOrEnd, ExpectCommaOrEnd };
+
+  bool inObject() const { return _depth && ((_stack >> (_depth - 1)) & 1); }
+
+  JsonToken setToken(JsonToken t, size_t start, size_t len) {
+    _type = t;
+    _escaped = false;
+    _start = start;
+    _tokLen = len;
+    return t;
+  }
+
+  JsonToken fail() { return setToken(JsonToken::Error, _pos, 0); }
+
+  JsonToken notFound() { return _type == JsonToken::Error ? _type : JsonToken::End; }
+
+  void skipSpace() {
+    size_t n = _json.length();
+    const char* d = _json.data();
+    while (_pos < n && (d[_pos] == ' ' || d[_pos] == '\n' || d[_pos] == '\r' || d[_pos] == '\t')) _pos++;
+  }
+
+  JsonToken openContainer(bool object) {
+    if (_depth >= VIEWS_JSON_MAX_DEPTH) return fail();
+    if (object) _stack |= (uint32_t)1 << _depth;
+    else _stack &= ~((uint32_t)1 << _depth);
+    _depth++;
+    _expect = object ? ExpectKeyOrEnd : ExpectValueOrEnd;
+    _pos++;
+    return setToken(object ? JsonToken::BeginObject : JsonToken::BeginArray, _pos - 1, 1);
+  }
+
+  JsonToken closeContainer(char c) {
+    if (_depth == 0 || (c == '}') != inObject()) return fail();
+    _depth--;
+    _expect = ExpectCommaOrEnd;
+    _pos++;
+    return setToken(c == '}' ? JsonToken::EndObject : JsonToken::EndArray, _pos - 1, 1);
+  }
+
+  /**
+   * @brief Scans the string whose opening quote is at _pos and makes its
+   * content the token slice. memchr jumps between quotes and backslashes,
+   * so plain runs of text are not examined byte by byte.
+   */
+  bool scanString() {
+    const char* d = _json.data();
+    size_t n = _json.length();
+    bool escaped = false;
+    for (size_t i = _pos + 1; i < n;) {
+      const char* quote = (const char*)memchr(d + i, '"', n - i);
+      if (!quote) break;
+      size_t end = (size_t)(quote - d);
+      const char* slash = (const char*)memchr(d + i, '\\', end - i);
+      if (!slash) {
+        _start = _pos + 1;
+        _tokLen = end - _start;
+        _escaped = escaped;
+        _pos = end + 1;
+        return true;
+      }
+      escaped = true;
+      i = (size_t)(slash - d) + 2;  // past the escaped character
+    }
+    return false;
+  }
+
+  JsonToken literal(const char* word, size_t len, JsonToken t) {
+    if (_json.length() - _pos < len || memcmp(_json.data() + _pos, word, len) != 0) return fail();
+    setToken(t, _pos, len);
+    _pos += len;
+    return t;
+  }
+
+  /** @brief Index past the digits starting at i. */
+  size_t skipDigits(size_t i) const {
+    while (i < _json.length() && view_detail::isDigit(_json[i])) i++;
+    return i;
+  }
+
+  /** @brief RFC 8259 number: -? (0 | [1-9][0-9]*) (.[0-9]+)? ([eE][+-]?[0-9]+)? */
+  JsonToken number() {
+    const char* d = _json.data();
+    size_t n = _json.length();
+    size_t i = _pos;
+    if (i < n && d[i] == '-') i++;
+    if (i >= n || !view_detail::isDigit(d[i])) return fail();
+    i = (d[i] == '0') ? i + 1 : skipDigits(i);
+    if (i < n && d[i] == '.') {
+      if (i + 1 >= n || !view_detail::isDigit(d[i + 1])) return fail();
+      i = skipDigits(i + 1);
+    }
+    if (i < n && (d[i] == 'e' || d[i] == 'E')) {
+      i++;
+      if (i < n && (d[i] == '+' || d[i] == '-')) i++;
+      if (i >= n || !view_detail::isDigit(d[i])) return fail();
+      i = skipDigits(i);
+    }
+    setToken(JsonToken::Number, _pos, i - _pos);
+    _pos = i;
+    return JsonToken::Number;
+  }
+
+  StringView _json;
+  size_t _pos;
+  size_t _start;  ///< Token slice in _json.
+  size_t _tokLen;
+  JsonToken _type;
+  uint32_t _stack; ///< Bit d set: nesting level d is an object.
+  uint8_t _depth;
+  Expect _expect;
+  bool _escaped;
+};
+
+#endif
@@ -0,0 +1,238 @@
+#ifndef KEYWORD_MATCHER_H
+#define KEYWORD_MATCHER_H
+
+#include "Views.h"
+
+/**
+ * @brief Number of hash seeds tried at compile time for each KeywordMatcher.
+ * A seed that gives every keyword its own slot makes a lookup one compare;
+ * if none is found, keywords sharing a slot are compared in turn.
+ */
+#ifndef VIEWS_KEYWORD_SEEDS
+#define VIEWS_KEYWORD_SEEDS 256
+#endif
+
+namespace view_detail {
+
+/** @brief FNV-1a over s[0, n), usable in constant expressions. */
+constexpr uint32_t fnv1a(const char* s, size_t n, uint32_t h = 2166136261UL) {
+  return n == 0 ? h : fnv1a(s + 1, n - 1, (uint32_t)((h ^ (uint8_t)*s) * 16777619UL));
+}
+
+/** @brief Slot of a keyword hash in a table of 2^bits entries. */
+constexpr uint8_t keywordSlot(uint32_t hash, uint32_t seed, uint8_t bits) {
+  return (uint8_t)((uint32_t)((hash ^ seed) * 2654435761UL) >> (32 - bits));
+}
+
+// Compile-time helpers for KeywordLayout. Ranges are split in halves so the
+// recursion depth stays logarithmic in the number of keywords and seeds.
+
+/**
+ * @brief Table size for n keywords: at least n^2 / 2 slots (capped at 256),
+ * which makes a collision-free seed likely within a few tries.
+ */
+constexpr uint8_t keywordBits(size_t n, uint8_t bits = 1) {
+  return (bits >= 8 || ((size_t)1 << bits) >= ((n * n / 2 > 2 * n) ? n * n / 2 : 2 * n))
+         ? bits : keywordBits(n, bits + 1);
+}
+
+/** @brief True if no hash in [lo, hi) shares a slot with hash i. */
+template<size_t N>
+constexpr bool slotApart(const ConstArray<uint32_t, N>& h, size_t i, size_t lo, size_t hi,
+                         uint32_t seed, uint8_t bits) {
+  return (lo >= hi) ? true
+       : (hi - lo == 1) ? keywordSlot(h.v[i], seed, bits) != keywordSlot(h.v[lo], seed, bits)
+       : slotApart(h, i, lo, lo + (hi - lo) / 2, seed, bits) &&
+         slotApart(h, i, lo + (hi - lo) / 2, hi, seed, bits);
+}
+
+/** @brief True if the hashes in [lo, hi) collide with no later hash. */
+template<size_t N>
+constexpr bool collisionFree(const ConstArray<uint32_t, N>& h, size_t lo, size_t hi,
+                             uint32_t seed, uint8_t bits) {
+  return (hi - lo == 1) ? slotApart(h, lo, lo + 1, N, seed, bits)
+       : collisionFree(h, lo, lo + (hi - lo) / 2, seed, bits) &&
+         collisionFree(h, lo + (hi - lo) / 2, hi, seed, bits);
+}
+
+template<size_t N>
+constexpr uint32_t firstSeed(const ConstArray<uint32_t, N>& h, uint32_t lo, uint32_t hi, uint8_t bits);
+
+template<size_t N>
+constexpr uint32_t pickSeed(uint32_t found, const ConstArray<uint32_t, N>& h,
+                            uint32_t lo, uint32_t hi, uint8_t bits) {
+  return found < (uint32_t)VIEWS_KEYWORD_SEEDS ? found : firstSeed(h, lo, hi, bits);
+}
+
+/** @brief First collision-free seed in [lo, hi), or VIEWS_KEYWORD_SEEDS. */
+template<size_t N>
+constexpr uint32_t firstSeed(const ConstArray<uint32_t, N>& h, uint32_t lo, uint32_t hi, uint8_t bits) {
+  return (hi - lo == 1) ? (collisionFree(h, 0, N, lo, bits) ? lo : (uint32_t)VIEWS_KEYWORD_SEEDS)
+       : pickSeed(firstSeed(h, lo, lo + (hi - lo) / 2, bits), h, lo + (hi - lo) / 2, hi, bits);
+}
+
+/** @brief Entries in [lo, hi) ordered before entry i by (slot, index). */
+template<size_t N>
+constexpr size_t slotRank(const ConstArray<uint8_t, N>& s, size_t i, size_t lo, size_t hi) {
+  return (hi - lo == 1) ? ((s.v[lo] < s.v[i] || (s.v[lo] == s.v[i] && lo < i)) ? 1 : 0)
+       : slotRank(s, i, lo, lo + (hi - lo) / 2) + slotRank(s, i, lo + (hi - lo) / 2, hi);
+}
+
+/** @brief Entries in [lo, hi) whose slot is below slot. */
+template<size_t N>
+constexpr size_t slotsBelow(const ConstArray<uint8_t, N>& s, size_t slot, size_t lo, size_t hi) {
+  return (hi - lo == 1) ? (s.v[lo] < slot ? 1 : 0)
+       : slotsBelow(s, slot, lo, lo + (hi - lo) / 2) + slotsBelow(s, slot, lo + (hi - lo) / 2, hi);
+}
+
+/** @brief True if some entry in [lo, hi) has rank k. */
+template<size_t N>
+constexpr bool hasRank(const ConstArray<uint8_t, N>& r, size_t k, size_t lo, size_t hi) {
+  return (hi - lo == 1) ? r.v[lo] == k
+       : hasRank(r, k, lo, lo + (hi - lo) / 2) || hasRank(r, k, lo + (hi - lo) / 2, hi);
+}
+
+/** @brief The entry in [lo, hi) with rank k. */
+template<size_t N>
+constexpr size_t withRank(const ConstArray<uint8_t, N>& r, size_t k, size_t lo, size_t hi) {
+  return (hi - lo == 1) ? lo
+       : hasRank(r, k, lo, lo + (hi - lo) / 2) ? withRank(r, k, lo, lo + (hi - lo) / 2)
+       : withRank(r, k, lo + (hi - lo) / 2, hi);
+}
+
+/** @brief Total length of the first k keywords in layout order. */
+template<size_t N>
+constexpr size_t layoutOffset(const ConstArray<uint8_t, N>& len, const ConstArray<uint8_t, N>& order,
+                              size_t k) {
+  return k == 0 ? 0 : layoutOffset(len, order, k - 1) + len.v[order.v[k - 1]];
+}
+
+/** @brief Last position in [lo, hi) whose offset is at most c. */
+template<size_t M>
+constexpr size_t offsetHolder(const ConstArray<uint16_t, M>& off, size_t c, size_t lo, size_t hi) {
+  return (hi - lo == 1) ? lo
+       : (off.v[lo + (hi - lo) / 2] <= c) ? offsetHolder(off, c, lo + (hi - lo) / 2, hi)
+       : offsetHolder(off, c, lo, lo + (hi - lo) / 2);
+}
+
+/**
+ * @brief Seed, slot table and text layout of one keyword list, computed once
+ * by the compiler. Keywords are stored sorted by (slot, index), so each slot
+ * owns a contiguous run of layout positions.
+ */
+template<size_t N, const char* const (&Words)[N], typename Seq = typename MakeIndexSeq<N>::type>
+struct KeywordLayout;
+
+template<size_t N, const char* const (&Words)[N], size_t... I>
+struct KeywordLayout<N, Words, IndexSeq<I...> > {
+  static constexpr ConstArray<uint8_t, N> lens = {{ (uint8_t)cstrnlen(Words[I], 255)... }};
+  static constexpr ConstArray<uint32_t, N> hashes = {{ fnv1a(Words[I], cstrnlen(Words[I], 255))... }};
+
+  static constexpr uint8_t bits = keywordBits(N);
+  static constexpr size_t slots = (size_t)1 << bits;
+  static constexpr uint32_t found = firstSeed(hashes, 0, VIEWS_KEYWORD_SEEDS, bits);
+  static constexpr bool perfect = found < (uint32_t)VIEWS_KEYWORD_SEEDS;
+  static constexpr uint32_t seed = perfect ? found : 0;
+
+  static constexpr ConstArray<uint8_t, N> slotOf = {{ keywordSlot(hashes.v[I], seed, bits)... }};
+  static constexpr ConstArray<uint8_t, N> rank = {{ (uint8_t)slotRank(slotOf, I, 0, N)... }};
+  static constexpr ConstArray<uint8_t, N> order = {{ (uint8_t)withRank(rank, I, 0, N)... }};
+  static constexpr ConstArray<uint16_t, N + 1> offsets = {{
+    (uint16_t)layoutOffset(lens, order, I)..., (uint16_t)layoutOffset(lens, order, N)
+  }};
+
+  static constexpr size_t maxLen = maxOf(lens, 0, N);
+  static constexpr size_t minLen = minOf(lens, 0, N);
+  static constexpr size_t textLen = offsets.v[N];
+
+  /** @brief First layout position of each slot; entry `slots` is N. */
+  struct Starts {
+    static constexpr uint8_t at(size_t s) { return (uint8_t)(s < slots ? slotsBelow(slotOf, s, 0, N) : N); }
+  };
+  /** @brief Original index of each layout position. */
+  struct Order {
+    static constexpr uint8_t at(size_t k) { return order.v[k]; }
+  };
+  /** @brief Text offset of each layout position; entry N is textLen. */
+  struct Offsets {
+    static constexpr uint16_t at(size_t k) { return offsets.v[k]; }
+  };
+  /** @brief All keywords concatenated in layout order, without terminators. */
+  struct Text {
+    static constexpr char at(size_t c) { return charAt(c, offsetHolder(offsets, c, 0, N)); }
+    static constexpr char charAt(size_t c, size_t k) { return Words[order.v[k]][c - offsets.v[k]]; }
+  };
+};
+
+} // namespace view_detail
+
+/**
+ * @class KeywordMatcher
+ * @brief Maps a token to its index in a fixed keyword list with one hash and
+ * (usually) one compare, replacing `if (tok == "...") else if` chains.
+ * @tparam N Number of keywords (at most 128, each 1-254 characters).
+ * @tparam Words A namespace-scope `constexpr const char* name[]` array.
+ *
+ * The seed search, slot table and a copy of the keyword text are produced by
+ * the compiler and placed in flash (VIEWS_FLASH). The Words array itself is
+ * only read at compile time, so the linker can drop it.
+ *
+ * @code
+ * constexpr const char* kAtWords[] = {"OK", "ERROR", "RING", "NO CARRIER"};
+ * typedef KeywordMatcher<4, kAtWords> AtResponse;
+ *
+ * switch (AtResponse::find(line)) {
+ *   case 0: ...   // "OK"
+ *   case -1: ...  // not a keyword
+ * }
+ * @endcode
+ */
+template<size_t N, const char* const (&Words)[N]>
+class KeywordMatcher {
+  typedef view_detail::KeywordLayout<N, Words> L;
+  static_assert(N > 0 && N <= 128, "KeywordMatcher supports 1 to 128 keywords");
+  static_assert(L::minLen > 0 && L::maxLen < 255, "keywords must be 1-254 characters");
+  static_assert(L::textLen < 65536, "keyword text must total under 64 KiB");
+
+public:
+  /**
+   * @brief Index of s in the keyword list, or -1 if it is not a keyword.
+   * Comparison is exact (case-sensitive).
+   */
+  static int find(const StringView& s) {
+    size_t n = s.length();
+    if (n - 1 >= L::maxLen) return -1;
+    uint8_t slot = view_detail::keywordSlot(view_detail::fnv1a(s.data(), n), L::seed, L::bits);
+    const uint8_t* starts = Starts::data();
+    const uint16_t* offsets = Offsets::data();
+    uint8_t end = view_detail::flashRead(&starts[slot + 1]);
+    for (uint8_t k = view_detail::flashRead(&starts[slot]); k < end; k++) {
+      uint16_t at = view_detail::flashRead(&offsets[k]);
+      if ((size_t)(view_detail::flashRead(&offsets[k + 1]) - at) == n &&
+          VIEWS_FLASH_CMP(s.data(), Text::data() + at, n) == 0)
+        return view_detail::flashRead(&Order::data()[k]);
+    }
+    return -1;
+  }
+
+  /** @brief True if s is one of the keywords. */
+  static bool contains(const StringView& s) { return find(s) >= 0; }
+
+  /** @brief Number of keywords. */
+  static constexpr size_t size() { return N; }
+
+  /** @brief True if every keyword has its own slot (one compare per lookup). */
+  static constexpr bool isPerfect() { return L::perfect; }
+
+private:
+  typedef view_detail::FlashTable<uint8_t, typename L::Starts,
+                                  typename view_detail::MakeIndexSeq<L::slots + 1>::type> Starts;
+  typedef view_detail::FlashTable<uint8_t, typename L::Order,
+                                  typename view_detail::MakeIndexSeq<N>::type> Order;
+  typedef view_detail::FlashTable<uint16_t, typename L::Offsets,
+                                  typename view_detail::MakeIndexSeq<N + 1>::type> Offsets;
+  typedef view_detail::FlashTable<char, typename L::Text,
+                                  typename view_detail::MakeIndexSeq<L::textLen>::type> Text;
+};
+
+#endif
@@ -0,0 +1,308 @@
+#ifndef MULTI_MATCHER_H
+#define MULTI_MATCHER_H
+
+#include "Views.h"
+#include "RingView.h"
+
+namespace view_detail {
+
+/** @brief Bit offset for a pattern of len bits after `at`, moved to the next word if it would straddle one. */
+constexpr size_t placePattern(size_t at, size_t len) {
+  return (at % 32 + len > 32) ? (at / 32 + 1) * 32 : at;
+}
+
+/** @brief Bit offset of pattern k: patterns are packed in order, none straddling a 32-bit word. */
+template<size_t N>
+constexpr size_t packedOffset(const ConstArray<uint8_t, N>& len, size_t k) {
+  return k == 0 ? 0 : placePattern(packedOffset(len, k - 1) + len.v[k - 1], len.v[k]);
+}
+
+/** @brief Bit (c & 31) for each character c of s with c / 32 == w. */
+constexpr uint32_t charBits(const char* s, size_t w) {
+  return *s == '\0' ? 0
+       : ((((uint8_t)*s >> 5) == w) ? (uint32_t)1 << ((uint8_t)*s & 31) : 0) | charBits(s + 1, w);
+}
+
+/** @brief Bits bit, bit + 1, ... for the characters of s equal to c. */
+constexpr uint32_t positionBits(const char* s, uint8_t c, size_t bit) {
+  return *s == '\0' ? 0
+       : (((uint8_t)*s == c) ? (uint32_t)1 << bit : 0) | positionBits(s + 1, c, bit + 1);
+}
+
+constexpr size_t popcount32(uint32_t v) { return v ? (v & 1) + popcount32(v >> 1) : 0; }
+
+/**
+ * @brief Shift-And layout of a pattern list, computed once by the compiler.
+ * Pattern k owns bits [offsets[k], offsets[k] + lens[k]) of a multi-word
+ * state. Bytes that occur in some pattern are numbered 1, 2, ... (their
+ * class); every other byte is class 0 and clears the state.
+ */
+template<size_t N, const char* const (&Patterns)[N], typename Seq = typename MakeIndexSeq<N>::type>
+struct MultiLayout;
+
+template<size_t N, const char* const (&Patterns)[N], size_t... I>
+struct MultiLayout<N, Patterns, IndexSeq<I...> > {
+  static constexpr ConstArray<uint8_t, N> lens = {{ (uint8_t)cstrnlen(Patterns[I], 33)... }};
+  static constexpr ConstArray<uint16_t, N> offsets = {{ (uint16_t)packedOffset(lens, I)... }};
+
+  static constexpr size_t maxLen = maxOf(lens, 0, N);
+  static constexpr size_t minLen = minOf(lens, 0, N);
+  static constexpr size_t words = (offsets.v[N - 1] + lens.v[N - 1] + 31) / 32;
+
+  /** @brief Characters c / 32 == w that occur in patterns [k, N), as a bitmap. */
+  static constexpr uint32_t seenIn(size_t w, size_t k) {
+    return k == N ? 0 : charBits(Patterns[k], w) | seenIn(w, k + 1);
+  }
+  static constexpr ConstArray<uint32_t, 8> seen = {{
+    seenIn(0, 0), seenIn(1, 0), seenIn(2, 0), seenIn(3, 0),
+    seenIn(4, 0), seenIn(5, 0), seenIn(6, 0), seenIn(7, 0)
+  }};
+
+  /** @brief Distinct pattern characters below 32 * w. */
+  static constexpr size_t seenBelow(size_t w) {
+    return w == 0 ? 0 : popcount32(seen.v[w - 1]) + seenBelow(w - 1);
+  }
+  static constexpr uint8_t classOf(size_t c) {
+    return ((seen.v[c >> 5] >> (c & 31)) & 1)
+         ? (uint8_t)(1 + seenBelow(c >> 5) + popcount32(seen.v[c >> 5] & (((uint32_t)1 << (c & 31)) - 1)))
+         : 0;
+  }
+  static constexpr size_t classes = 1 + seenBelow(8);
+
+  /** @brief The character of class k (k >= 1). */
+  static constexpr uint8_t charOf(size_t k, size_t c = 0) {
+    return (c >= 255 || classOf(c) == k) ? (uint8_t)c : charOf(k, c + 1);
+  }
+
+  /** @brief Bits in word w of patterns [k, N) whose character is c. */
+  static constexpr uint32_t maskIn(uint8_t c, size_t w, size_t k) {
+    return k == N ? 0
+         : ((size_t)(offsets.v[k] >> 5) == w ? positionBits(Patterns[k], c, offsets.v[k] & 31) : 0) |
+           maskIn(c, w, k + 1);
+  }
+  /** @brief First (end = 0) or last (end = 1) bit in word w of patterns [k, N). */
+  static constexpr uint32_t edgeIn(size_t w, size_t end, size_t k) {
+    return k == N ? 0
+         : ((size_t)(offsets.v[k] >> 5) == w ? (uint32_t)1 << ((offsets.v[k] + end * (lens.v[k] - 1)) & 31) : 0) |
+           edgeIn(w, end, k + 1);
+  }
+
+  /** @brief Class of each byte (0 if it is in no pattern). */
+  struct Classes {
+    static constexpr uint8_t at(size_t c) { return classOf(c); }
+  };
+  /** @brief Mask words of classes 1, 2, ...: entry (k - 1) * words + w. */
+  struct Masks {
+    static constexpr uint32_t at(size_t i) { return maskIn(charOf(i / words + 1), i % words, 0); }
+  };
+  /** @brief Start bits (entries [0, words)) then final bits (entries [words, 2 * words)). */
+  struct Edges {
+    static constexpr uint32_t at(size_t i) { return edgeIn(i % words, i / words, 0); }
+  };
+  /** @brief Final bit of each pattern across the whole state, ascending. */
+  struct Ends {
+    static constexpr uint16_t at(size_t k) { return (uint16_t)(offsets.v[k] + lens.v[k] - 1); }
+  };
+  struct Lengths {
+    static constexpr uint8_t at(size_t k) { return lens.v[k]; }
+  };
+};
+
+} // namespace view_detail
+
+/** @brief One occurrence reported by MultiMatcher. */
+struct MultiMatch {
+  int pattern;    ///< Index in the pattern list, or -1 if nothing matched.
+  size_t end;     ///< Offset just past the match's last character.
+  size_t length;  ///< Length of the pattern (0 if nothing matched).
+
+  /** @brief True if a pattern matched. */
+  bool found() const { return pattern >= 0; }
+
+  /** @brief Offset of the match's first character. */
+  size_t start() const { return end - length; }
+};
+
+/**
+ * @class MultiMatcher
+ * @brief Finds every occurrence of a fixed set of patterns in one pass over
+ * the input, instead of one indexOf() per pattern: AT result codes in a modem
+ * stream, error markers in a log, several delimiters at once.
+ * @tparam N Number of patterns (at most 64, each 1-32 characters).
+ * @tparam Patterns A namespace-scope `constexpr const char* name[]` array.
+ *
+ * All patterns are run together as one bit-parallel Shift-And automaton: the
+ * state is one bit per pattern character, packed into kWords 32-bit words
+ * (e.g. 3 words for 15 AT result codes), and each input byte costs one class
+ * lookup plus a shift, OR and AND per word, whatever the number of patterns.
+ * The class and mask tables are produced by the compiler and placed in flash
+ * (VIEWS_FLASH); the Patterns array is only read at compile time.
+ *
+ * The state survives between calls, so a stream can be fed in chunks of any
+ * size (UART reads, FrameScanner fragments, both halves of a RingView) and a
+ * pattern split across chunks is still found. Offsets in reported matches
+ * count every byte fed since reset(). Overlapping occurrences are all
+ * reported; several patterns ending at the same byte are reported in list
+ * order. Matching is exact (case-sensitive).
+ *
+ * @code
+ * constexpr const char* kUrcs[] = {"OK\r\n", "ERROR", "+CMTI:", "RING"};
+ * typedef MultiMatcher<4, kUrcs> UrcMatcher;
+ *
+ * static UrcMatcher urcs;
+ * urcs.scan(chunk, [](const MultiMatch& m) {
+ *   if (m.pattern == 2) newSms = true;
+ * });
+ * @endcode
+ */
+template<size_t N, const char* const (&Patterns)[N]>
+class MultiMatcher {
+  typedef view_detail::MultiLayout<N, Patterns> L;
+  static_assert(N > 0 && N <= 64, "MultiMatcher supports 1 to 64 patterns");
+  static_assert(L::minLen > 0 && L::maxLen <= 32, "patterns must be 1-32 characters");
+  static_assert(L::words <= 8, "patterns must fit in 256 state bits");
+
+public:
+  /** @brief 32-bit words of automaton state. */
+  static constexpr size_t kWords = L::words;
+
+  /** @brief Creates a matcher at the start of a stream. */
+  MultiMatcher() { reset(); }
+
+  /** @brief Forgets any partial match and restarts the stream offset at 0. */
+  void reset() {
+    memset(_state, 0, sizeof(_state));
+    _offset = 0;
+    _lastBit = -1;
+    _hit = false;
+  }
+
+  // --- Streaming ---
+
+  /**
+   * @brief The next match in chunk[pos, length()), continuing from the
+   * previous call. Advances pos past the byte that completed the match.
+   * @return A match with found() false once the chunk is used up.
+   */
+  MultiMatch next(const StringView& chunk, size_t& pos) {
+    for (;;) {
+      if (_hit) {
+        int p = nextHit();
+        if (p >= 0) return MultiMatch{p, _offset, patternLength((size_t)p)};
+        _hit = false;
+      }
+      if (pos >= chunk.length()) return MultiMatch{-1, _offset, 0};
+      _hit = step((uint8_t)chunk.data()[pos++]);
+    }
+  }
+
+  /**
+   * @brief Feeds a chunk, calling onMatch(const MultiMatch&) for each match.
+   * @return Number of matches reported.
+   */
+  template<typename F>
+  size_t scan(const StringView& chunk, F onMatch) {
+    size_t pos = 0, count = 0;
+    for (MultiMatch m = next(chunk, pos); m.found(); m = next(chunk, pos)) {
+      onMatch(m);
+      count++;
+    }
+    return count;
+  }
+
+  /** @brief Feeds both segments of a ring buffer region, in order. */
+  template<typename F>
+  size_t scan(const RingView<char>& region, F onMatch) {
+    size_t count = scan(StringView(region.first()), onMatch);
+    return count + scan(StringView(region.second()), onMatch);
+  }
+
+  /** @brief Bytes fed since reset(): the end offset of a match found now. */
+  size_t position() const { return _offset; }
+
+  // --- One-shot search ---
+
+  /**
+   * @brief The first occurrence of any pattern in text[from, length()), by
+   * end offset (the earliest in list order on a tie).
+   * @return Offsets relative to text, or a match with found() false.
+   */
+  static MultiMatch find(const StringView& text, size_t from = 0) {
+    MultiMatcher m;
+    size_t pos = from;
+    MultiMatch r = m.next(text, pos);
+    r.end = pos;
+    return r;
+  }
+
+  /** @brief True if text contains any of the patterns. */
+  static bool containsAny(const StringView& text) { return find(text).found(); }
+
+  // --- Patterns ---
+
+  /** @brief Number of patterns. */
+  static constexpr size_t size() { return N; }
+
+  /** @brief Length of pattern k. */
+  static size_t patternLength(size_t k) { return view_detail::flashRead(&Lengths::data()[k]); }
+
+private:
+  typedef view_detail::FlashTable<uint8_t, typename L::Classes,
+                                  typename view_detail::MakeIndexSeq<256>::type> Classes;
+  typedef view_detail::FlashTable<uint32_t, typename L::Masks,
+                                  typename view_detail::MakeIndexSeq<(L::classes - 1) * L::words>::type> Masks;
+  typedef view_detail::FlashTable<uint32_t, typename L::Edges,
+                                  typename view_detail::MakeIndexSeq<2 * L::words>::type> Edges;
+  typedef view_detail::FlashTable<uint16_t, typename L::Ends,
+                                  typename view_detail::MakeIndexSeq<N>::type> Ends;
+  typedef view_detail::FlashTable<uint8_t, typename L::Lengths,
+                                  typename view_detail::MakeIndexSeq<N>::type> Lengths;
+
+  /** @brief Advances the automaton by one byte; true if some pattern ends here. */
+  bool step(uint8_t c) {
+    _offset++;
+    _lastBit = -1;
+    uint8_t k = view_detail::flashRead(&Classes::data()[c]);
+    if (k == 0) {
+      memset(_state, 0, sizeof(_state));
+      return false;
+    }
+    const uint32_t* mask = Masks::data() + (size_t)(k - 1) * kWords;
+    const uint32_t* edges = Edges::data();
+    uint32_t hits = 0;
+    for (size_t w = 0; w < kWords; w++) {
+      uint32_t s = ((_state[w] << 1) | view_detail::flashRead(&edges[w])) & view_detail::flashRead(&mask[w]);
+      _state[w] = s;
+      hits |= s & view_detail::flashRead(&edges[kWords + w]);
+    }
+    return hits != 0;
+  }
+
+  /** @brief Next pattern ending at the current byte after the last one reported, or -1. */
+  int nextHit() {
+    const uint32_t* finals = Edges::data() + kWords;
+    for (size_t g = (size_t)(_lastBit + 1); g < kWords * 32; g = (g | 31) + 1) {
+      uint32_t h = (_state[g >> 5] & view_detail::flashRead(&finals[g >> 5])) >> (g & 31);
+      if (!h) continue;
+      while (!(h & 1)) {
+        h >>= 1;
+        g++;
+      }
+      _lastBit = (int16_t)g;
+      const uint16_t* ends = Ends::data();
+      for (size_t k = 0; k < N; k++)
+        if (view_detail::flashRead(&ends[k]) == g) return (int)k;
+    }
+    return -1;
+  }
+
+  uint32_t _state[kWords];
+  size_t _offset;
+  int16_t _lastBit;
+  bool _hit;
+};
+
+template<size_t N, const char* const (&Patterns)[N]>
+constexpr size_t MultiMatcher<N, Patterns>::kWords;
+
+#endif
@@ -0,0 +1,284 @@
+#ifndef MUTABLE_VIEW_H
+#define MUTABLE_VIEW_H
+
+#include "Views.h"
+
+namespace view_detail {
+
+/** @brief Reverses the byte order of one value in place. */
+inline void swapBytes(uint8_t* p, size_t n) {
+  for (size_t i = 0, j = n - 1; i < j; i++, j--) {
+    uint8_t t = p[i];
+    p[i] = p[j];
+    p[j] = t;
+  }
+}
+
+#if VIEWS_USE_SWAR
+inline void storeWord(uint8_t* p, Word w) { memcpy(p, &w, sizeof(Word)); }
+
+inline Word reverseWord(Word w) {
+#if UINTPTR_MAX > 0xFFFFFFFFu
+  return __builtin_bswap64(w);
+#else
+  return __builtin_bswap32(w);
+#endif
+}
+#endif
+
+/** @brief Applies a per-byte map to d[0, n), a word at a time where enabled. */
+template<typename ByteFn, typename WordFn>
+void mapBytes(uint8_t* d, size_t n, ByteFn byteFn, WordFn wordFn) {
+  size_t i = 0;
+#if VIEWS_USE_SWAR
+  for (; i < n && !isWordAligned(d + i); i++) d[i] = byteFn(d[i]);
+  for (; i + sizeof(Word) <= n; i += sizeof(Word)) storeWord(d + i, wordFn(loadWord(d + i)));
+#else
+  (void)wordFn;
+#endif
+  for (; i < n; i++) d[i] = byteFn(d[i]);
+}
+
+inline uint8_t lowerByte(uint8_t c) { return (uint8_t)(c - 'A') < 26 ? c | 0x20 : c; }
+inline uint8_t upperByte(uint8_t c) { return (uint8_t)(c - 'a') < 26 ? c & ~0x20 : c; }
+
+#if VIEWS_USE_SWAR
+struct LowerWord { Word operator()(Word w) const { return lowerWord(w); } };
+struct UpperWord { Word operator()(Word w) const { return upperWord(w); } };
+
+struct ReplaceWord {
+  Word from, to;
+  Word operator()(Word w) const {
+    Word hit = (byteEqualMask(w, from) >> 7) * 0xFF;
+    return (w & ~hit) | (to & hit);
+  }
+};
+#else
+struct LowerWord { uint32_t operator()(uint32_t w) const { return w; } };
+struct UpperWord { uint32_t operator()(uint32_t w) const { return w; } };
+struct ReplaceWord { uint32_t operator()(uint32_t w) const { return w; } };
+#endif
+
+struct LowerByte { uint8_t operator()(uint8_t c) const { return lowerByte(c); } };
+struct UpperByte { uint8_t operator()(uint8_t c) const { return upperByte(c); } };
+
+struct ReplaceByte {
+  uint8_t from, to;
+  uint8_t operator()(uint8_t c) const { return c == from ? to : c; }
+};
+
+/** @brief In-place primitives; the byte specialisation works a word at a time. */
+template<typename T, bool Byte = IsByteLike<T>::value>
+struct MutOps {
+  static void fill(T* d, size_t n, const T& value) { CopyOps<T>::fill(d, n, value); }
+  static void replace(T* d, size_t n, const T& from, const T& to) {
+    for (size_t i = 0; i < n; i++)
+      if (d[i] == from) d[i] = to;
+  }
+  static void reverse(T* d, size_t n) {
+    for (size_t i = 0, j = n; i + 1 < j; i++, j--) {
+      T t = d[i];
+      d[i] = d[j - 1];
+      d[j - 1] = t;
+    }
+  }
+};
+
+template<typename T>
+struct MutOps<T, true> {
+  static void fill(T* d, size_t n, const T& value) { memset(d, (uint8_t)value, n); }
+  static void replace(T* d, size_t n, const T& from, const T& to) {
+    ReplaceByte byteFn = {(uint8_t)from, (uint8_t)to};
+#if VIEWS_USE_SWAR
+    ReplaceWord wordFn = {kLowBits * (uint8_t)from, kLowBits * (uint8_t)to};
+#else
+    ReplaceWord wordFn;
+#endif
+    mapBytes(reinterpret_cast<uint8_t*>(d), n, byteFn, wordFn);
+  }
+  static void reverse(T* data, size_t n) {
+    uint8_t* d = reinterpret_cast<uint8_t*>(data);
+    size_t i = 0, j = n;
+#if VIEWS_USE_SWAR
+    for (; j - i >= 2 * sizeof(Word); i += sizeof(Word), j -= sizeof(Word)) {
+      Word a = loadWord(d + i);
+      Word b = loadWord(d + j - sizeof(Word));
+      storeWord(d + i, reverseWord(b));
+      storeWord(d + j - sizeof(Word), reverseWord(a));
+    }
+#endif
+    for (; i + 1 < j; i++, j--) {
+      uint8_t t = d[i];
+      d[i] = d[j - 1];
+      d[j - 1] = t;
+    }
+  }
+};
+
+} // namespace view_detail
+
+/**
+ * @class MutableView
+ * @brief A non-owning, writable window into a contiguous array.
+ * @tparam T The type of the data elements.
+ *
+ * Derives from MemoryView<T>, so it converts implicitly to the read-only view
+ * and every read-only operation is available on it. Bulk operations use
+ * memset/memmove or word-wide loops for trivially copyable T.
+ */
+template<typename T>
+class MutableView : public MemoryView<T> {
+public:
+  /** @brief Default constructor creating an empty view. */
+  MutableView() {}
+
+  /** @brief Constructs a view from a pointer and a specific length. */
+  MutableView(T* data, size_t len) : MemoryView<T>(data, len) {}
+
+  /** @brief Constructs a view over a whole fixed-size array. */
+  template<size_t N>
+  MutableView(T (&arr)[N]) : MemoryView<T>(arr, N) {}
+
+  /** @brief Gets the underlying writable pointer. */
+  T* data() const { return const_cast<T*>(this->_data); }
+
+  /** @brief Accesses an element by index for writing. */
+  T& operator[](size_t index) const { return data()[index]; }
+
+  /** @brief Iterator support (start). */
+  T* begin() const { return data(); }
+
+  /** @brief Iterator support (end). */
+  T* end() const { return data() + this->_len; }
+
+  /** @brief Creates a writable sub-view (same rules as MemoryView::slice). */
+  MutableView<T> slice(size_t start, size_t length = 0xFFFFFFFF) const {
+    if (start >= this->_len) return MutableView<T>();
+    size_t avail = this->_len - start;
+    return MutableView<T>(data() + start, (length > avail) ? avail : length);
+  }
+
+  // --- Bulk In-Place Operations ---
+
+  /** @brief Sets every element to value. */
+  void fill(const T& value) const { view_detail::MutOps<T>::fill(data(), this->_len, value); }
+
+  /**
+   * @brief Copies src into this view starting at index at; overlap is allowed.
+   * @return Number of elements copied (truncated to the space available).
+   */
+  size_t copyFrom(const MemoryView<T>& src, size_t at = 0) const {
+    size_t len = this->_len;
+    if (at >= len) return 0;
+    T* d = data() + at;
+    size_t n = (src.length() < len - at) ? src.length() : len - at;
+    view_detail::CopyOps<T>::move(d, src.data(), n);
+    return n;
+  }
+
+  /** @brief Reverses the order of the elements. */
+  void reverse() const { view_detail::MutOps<T>::reverse(data(), this->_len); }
+
+  /** @brief Replaces every occurrence of from with to. */
+  void replaceAll(const T& from, const T& to) const {
+    view_detail::MutOps<T>::replace(data(), this->_len, from, to);
+  }
+
+  /** @brief Lowercases ASCII letters in place (1-byte types only). */
+  void toLowerInPlace() const {
+    static_assert(view_detail::IsByteLike<T>::value, "toLowerInPlace needs a 1-byte type");
+    view_detail::mapBytes(reinterpret_cast<uint8_t*>(data()), this->_len,
+                          view_detail::LowerByte(), view_detail::LowerWord());
+  }
+
+  /** @brief Uppercases ASCII letters in place (1-byte types only). */
+  void toUpperInPlace() const {
+    static_assert(view_detail::IsByteLike<T>::value, "toUpperInPlace needs a 1-byte type");
+    view_detail::mapBytes(reinterpret_cast<uint8_t*>(data()), this->_len,
+                          view_detail::UpperByte(), view_detail::UpperWord());
+  }
+
+  /** @brief Reverses the byte order of every element (endianness conversion). */
+  void byteSwapInPlace() const {
+    static_assert(__is_trivially_copyable(T), "byteSwapInPlace needs a trivially copyable type");
+    uint8_t* d = reinterpret_cast<uint8_t*>(data());
+    for (size_t i = 0; i < this->_len; i++, d += sizeof(T)) {
+      switch (sizeof(T)) {
+        case 1:
+          return;
+        case 2: {
+          uint16_t v;
+          memcpy(&v, d, 2);
+          v = __builtin_bswap16(v);
+          memcpy(d, &v, 2);
+          break;
+        }
+        case 4: {
+          uint32_t v;
+          memcpy(&v, d, 4);
+          v = __builtin_bswap32(v);
+          memcpy(d, &v, 4);
+          break;
+        }
+        case 8: {
+          uint64_t v;
+          memcpy(&v, d, 8);
+          v = __builtin_bswap64(v);
+          memcpy(d, &v, 8);
+          break;
+        }
+        default:
+          view_detail::swapBytes(d, sizeof(T));
+          break;
+      }
+    }
+  }
+};
+
+/**
+ * @class MutableStringView
+ * @brief Writable character view; derives from StringView, so it can be
+ * passed anywhere a StringView is expected.
+ */
+class MutableStringView : public StringView {
+public:
+  /** @brief Default constructor creating an empty view. */
+  MutableStringView() {}
+
+  /** @brief Constructs a view from a pointer and a specific length. */
+  MutableStringView(char* data, size_t len) : StringView(data, len) {}
+
+  /** @brief Promote MutableView<char> to MutableStringView. */
+  MutableStringView(const MutableView<char>& base) : StringView(base) {}
+
+  /** @brief The same characters as a MutableView<char>. */
+  MutableView<char> chars() const { return MutableView<char>(data(), _len); }
+
+  /** @brief Gets the underlying writable pointer. */
+  char* data() const { return const_cast<char*>(_data); }
+
+  /** @brief Accesses a character by index for writing. */
+  char& operator[](size_t index) const { return data()[index]; }
+
+  /** @brief Iterator support (start). */
+  char* begin() const { return data(); }
+
+  /** @brief Iterator support (end). */
+  char* end() const { return data() + _len; }
+
+  /** @brief Creates a writable sub-view. */
+  MutableStringView slice(size_t start, size_t length = 0xFFFFFFFF) const {
+    return MutableStringView(chars().slice(start, length));
+  }
+
+  void fill(char c) const { chars().fill(c); }
+  size_t copyFrom(const MemoryView<char>& src, size_t at = 0) const {
+    return chars().copyFrom(src, at);
+  }
+  void reverse() const { chars().reverse(); }
+  void replaceAll(char from, char to) const { chars().replaceAll(from, to); }
+  void toLowerInPlace() const { chars().toLowerInPlace(); }
+  void toUpperInPlace() const { chars().toUpperInPlace(); }
+};
+
+#endif
@@ -0,0 +1,302 @@
+#ifndef PATTERN_MATCHER_H
+#define PATTERN_MATCHER_H
+
+#include "Views.h"
+
+namespace view_detail {
+
+// Pattern syntax shared by the matchers:
+//   ?       any one character
+//   [abc]   one of a, b, c; ranges as in [a-z0-9]; [!...] or [^...] negates;
+//           a ']' right after '[' (or '[!') is literal; an unclosed '[' is literal
+//   \x      the character x literally
+//   *       (globs only) any run of characters, including none
+// Everything else matches itself. The helpers are constexpr so the same code
+// builds the flash tables of GlobMatcher and ShiftOrMatcher at compile time.
+
+/** @brief Index of the ']' closing a class whose body starts at j, or n. */
+constexpr size_t classClose(const char* p, size_t n, size_t j, bool first) {
+  return j >= n ? n : (p[j] == ']' && !first) ? j : classClose(p, n, j + 1, false);
+}
+
+/** @brief First body character of the class opened at i (after any '!' or '^'). */
+constexpr size_t classBody(const char* p, size_t n, size_t i) {
+  return (i + 1 < n && (p[i + 1] == '!' || p[i + 1] == '^')) ? i + 2 : i + 1;
+}
+
+constexpr size_t starRunEnd(const char* p, size_t n, size_t i) {
+  return (i < n && p[i] == '*') ? starRunEnd(p, n, i + 1) : i;
+}
+
+/** @brief End of the token starting at i; with glob, a run of '*' is one token. */
+constexpr size_t tokenEnd(const char* p, size_t n, size_t i, bool glob) {
+  return p[i] == '\\' ? (i + 2 <= n ? i + 2 : n)
+       : (p[i] == '[' && classClose(p, n, classBody(p, n, i), true) < n)
+           ? classClose(p, n, classBody(p, n, i), true) + 1
+       : (glob && p[i] == '*') ? starRunEnd(p, n, i)
+       : i + 1;
+}
+
+constexpr size_t tokenCount(const char* p, size_t n, bool glob, size_t i = 0) {
+  return i >= n ? 0 : 1 + tokenCount(p, n, glob, tokenEnd(p, n, i, glob));
+}
+
+constexpr bool isStarToken(const char* p, size_t i, bool glob) { return glob && p[i] == '*'; }
+
+/** @brief True if c is in the class body p[j, end). */
+constexpr bool classHas(const char* p, size_t j, size_t end, uint8_t c) {
+  return j >= end ? false
+       : (j + 2 < end && p[j + 1] == '-')
+           ? (c >= (uint8_t)p[j] && c <= (uint8_t)p[j + 2]) || classHas(p, j + 3, end, c)
+       : (uint8_t)p[j] == c || classHas(p, j + 1, end, c);
+}
+
+/** @brief True if the (non-star) token at i, ending at end, matches c. */
+constexpr bool tokenAccepts(const char* p, size_t i, size_t end, uint8_t c) {
+  return p[i] == '?' ? true
+       : p[i] == '\\' ? (uint8_t)p[end - 1] == c
+       : (p[i] == '[' && end > i + 1)
+           ? classHas(p, (p[i + 1] == '!' || p[i + 1] == '^') ? i + 2 : i + 1, end - 1, c) !=
+             (p[i + 1] == '!' || p[i + 1] == '^')
+       : (uint8_t)p[i] == c;
+}
+
+/** @brief Smallest unsigned type with at least `bits` bits (up to 32). */
+template<size_t Bits, bool Fits8 = (Bits <= 8), bool Fits16 = (Bits <= 16)>
+struct MaskFor { typedef uint32_t type; };
+template<size_t Bits, bool Fits16> struct MaskFor<Bits, true, Fits16> { typedef uint8_t type; };
+template<size_t Bits> struct MaskFor<Bits, false, true> { typedef uint16_t type; };
+
+/**
+ * @brief Compile-time masks of one pattern. For glob NFAs bit t + 1 is set
+ * when token t consumes c; for Shift-Or bit t is set when token t does NOT
+ * match c (Shift-Or keeps its state complemented).
+ */
+template<const char* Pattern, bool Glob, typename M>
+struct PatternMasks {
+  static constexpr size_t len = cstrnlen(Pattern, 255);
+
+  static constexpr M shiftFirst(bool on, size_t t) { return on ? (M)((M)1 << t) : 0; }
+
+  /** @brief Tokens from t (starting at character i) that consume c, at bit t + Glob. */
+  static constexpr M consume(uint8_t c, size_t t, size_t i) {
+    return i >= len ? 0
+         : (M)((isStarToken(Pattern, i, Glob) ? 0
+                : shiftFirst(tokenAccepts(Pattern, i, tokenEnd(Pattern, len, i, Glob), c), t + Glob)) |
+               consume(c, t + 1, tokenEnd(Pattern, len, i, Glob)));
+  }
+
+  /** @brief Star tokens from t, at bit t (shift = 0) or t + 1 (shift = 1). */
+  static constexpr M stars(size_t t, size_t i, uint8_t shift) {
+    return i >= len ? 0
+         : (M)(shiftFirst(isStarToken(Pattern, i, Glob), t + shift) |
+               stars(t + 1, tokenEnd(Pattern, len, i, Glob), shift));
+  }
+
+  struct Table {
+    static constexpr M at(size_t c) { return Glob ? consume((uint8_t)c, 0, 0) : (M)~consume((uint8_t)c, 0, 0); }
+  };
+};
+
+/** @brief Runtime token list of a pattern: starts[t] and starts[t + 1] bound token t. */
+struct PatternTokens {
+  static const uint8_t kMax = 31;
+
+  /** @brief Splits p[0, n); false if the pattern is longer than 255 or has over kMax tokens. */
+  bool parse(const char* p, size_t n, bool glob) {
+    count = 0;
+    stars = 0;
+    if (n > 255) return false;
+    size_t i = 0;
+    while (i < n) {
+      if (count == kMax) return false;
+      if (isStarToken(p, i, glob)) stars |= (uint32_t)1 << count;
+      starts[count++] = (uint8_t)i;
+      i = tokenEnd(p, n, i, glob);
+    }
+    starts[count] = (uint8_t)n;
+    return true;
+  }
+
+  bool accepts(const char* p, uint8_t t, uint8_t c) const { return tokenAccepts(p, starts[t], starts[t + 1], c); }
+
+  uint8_t starts[kMax + 1];
+  uint8_t count;
+  uint32_t stars; ///< Bit t set if token t is a '*'.
+};
+
+} // namespace view_detail
+
+// --- MQTT ---
+
+/**
+ * @brief MQTT 3.1.1/5 topic filter matching: '+' matches one level, a
+ * trailing '#' matches any number of levels (including none, so "a/#"
+ * matches "a"). Filters starting with a wildcard do not match "$SYS"-style
+ * topics. Levels are compared with memcmp; no state, one pass.
+ */
+inline bool topicMatches(const StringView& filter, const StringView& topic) {
+  const char* fd = filter.data();
+  const char* td = topic.data();
+  size_t fn = filter.length(), tn = topic.length();
+  if (fn == 0 || tn == 0) return false;
+  if (td[0] == '$' && (fd[0] == '+' || fd[0] == '#')) return false;
+  size_t f = 0, t = 0;
+  for (;;) {
+    const char* fs = (const char*)memchr(fd + f, '/', fn - f);
+    size_t fe = fs ? (size_t)(fs - fd) : fn;
+    if (fe - f == 1 && fd[f] == '#') return fe == fn;
+    const char* ts = (t < tn) ? (const char*)memchr(td + t, '/', tn - t) : nullptr;
+    size_t te = ts ? (size_t)(ts - td) : tn;
+    bool plus = (fe - f == 1 && fd[f] == '+');
+    if (!plus && (fe - f != te - t || (fe > f && memcmp(fd + f, td + t, fe - f) != 0))) return false;
+    if (te == tn) {
+      // Topic exhausted: the filter must end too, or continue only with "/#".
+      return fe == fn || (fn - fe == 2 && fd[fe + 1] == '#');
+    }
+    if (fe == fn) return false;
+    f = fe + 1;
+    t = te + 1;
+  }
+}
+
+// --- Runtime patterns ---
+
+/**
+ * @brief Glob match of the whole text: "*.csv", "log_202?-*.txt",
+ * "[!_]*". Simulates the pattern's NFA with one bit per position (a
+ * Thompson NFA as a bitset), so time is linear in the text for a given
+ * pattern, with no backtracking and fixed stack use. Patterns are limited to
+ * 31 tokens (a class or escape is one token; "**" is one); longer ones
+ * never match.
+ */
+inline bool globMatch(const StringView& pattern, const StringView& text) {
+  view_detail::PatternTokens tok;
+  if (!tok.parse(pattern.data(), pattern.length(), true)) return false;
+  const char* p = pattern.data();
+  const uint32_t accept = (uint32_t)1 << tok.count;
+  const uint32_t selfLoop = tok.stars << 1;
+  uint32_t state = 1;
+  state |= (state & tok.stars) << 1;
+  for (size_t i = 0; i < text.length() && state; i++) {
+    uint8_t c = (uint8_t)text[i];
+    uint32_t next = state & selfLoop;
+    // Advance only the active positions whose next token consumes c.
+    for (uint32_t live = state & ~tok.stars & (accept - 1); live; live &= live - 1) {
+      uint8_t t = (uint8_t)__builtin_ctzl((unsigned long)live);
+      if (tok.accepts(p, t, c)) next |= (uint32_t)2 << t;
+    }
+    state = next | ((next & tok.stars) << 1);
+  }
+  return (state & accept) != 0;
+}
+
+/**
+ * @brief Finds the first occurrence of a fixed-length pattern (literals,
+ * '?', classes and escapes; '*' is a literal here) at or after from, with
+ * bit-parallel Shift-Or over at most 31 tokens.
+ * @return The matching span of text, or an empty view with a null data()
+ *         if there is none.
+ */
+inline StringView findPattern(const StringView& pattern, const StringView& text, size_t from = 0) {
+  view_detail::PatternTokens tok;
+  if (pattern.isEmpty() || !tok.parse(pattern.data(), pattern.length(), false)) return StringView();
+  const char* p = pattern.data();
+  const uint32_t done = (uint32_t)1 << (tok.count - 1);
+  uint32_t state = 0;  // bit t: the last t + 1 characters match tokens [0, t]
+  for (size_t i = from; i < text.length(); i++) {
+    uint8_t c = (uint8_t)text[i];
+    uint32_t next = 0;
+    // Extend the partial matches (and a new one at i) by c.
+    for (uint32_t live = ((state << 1) | 1) & ((done << 1) - 1); live; live &= live - 1) {
+      uint8_t t = (uint8_t)__builtin_ctzl((unsigned long)live);
+      if (tok.accepts(p, t, c)) next |= (uint32_t)1 << t;
+    }
+    state = next;
+    if (state & done) return StringView(text.data() + i + 1 - tok.count, tok.count);
+  }
+  return StringView();
+}
+
+// --- Compile-time patterns ---
+
+/**
+ * @class GlobMatcher
+ * @brief A glob whose NFA transition table the compiler builds into flash:
+ * each text character costs one table read and four bit operations, however
+ * long the pattern (up to 31 tokens). The table has 256 entries of the
+ * smallest mask type that fits (uint8_t up to 7 tokens, uint16_t up to 15).
+ * @tparam Pattern A namespace-scope `constexpr char name[]` glob.
+ *
+ * @code
+ * constexpr char kLogFiles[] = "log_20[0-9][0-9]-[01]?-*.txt";
+ * if (GlobMatcher<kLogFiles>::matches(entry.name())) ...
+ * @endcode
+ */
+template<const char* Pattern>
+class GlobMatcher {
+  static constexpr size_t kLen = view_detail::cstrnlen(Pattern, 255);
+  static constexpr size_t kTokens = view_detail::tokenCount(Pattern, kLen, true);
+  static_assert(kTokens <= 31, "GlobMatcher patterns are limited to 31 tokens");
+  typedef typename view_detail::MaskFor<kTokens + 1>::type Mask;
+  typedef view_detail::PatternMasks<Pattern, true, Mask> Masks;
+
+public:
+  /** @brief True if the whole text matches the pattern. */
+  static bool matches(const StringView& text) {
+    typedef view_detail::FlashTable<Mask, typename Masks::Table, view_detail::MakeIndexSeq<256>::type> Table;
+    const Mask* table = Table::data();
+    const Mask stars = Masks::stars(0, 0, 0);
+    const Mask selfLoop = Masks::stars(0, 0, 1);
+    Mask state = (Mask)(1 | (1 & stars) << 1);
+    for (size_t i = 0; i < text.length() && state; i++) {
+      Mask next = (Mask)(((Mask)(state << 1) & view_detail::flashRead(&table[(uint8_t)text[i]])) | (state & selfLoop));
+      state = (Mask)(next | (Mask)((next & stars) << 1));
+    }
+    return (state >> kTokens) & 1;
+  }
+};
+
+/**
+ * @class ShiftOrMatcher
+ * @brief Bit-parallel (Shift-Or) search for a fixed-length pattern
+ * (literals, '?', classes, escapes) whose 256-entry mask table the
+ * compiler builds into flash: one table read, one shift and one OR per
+ * text character.
+ * @tparam Pattern A namespace-scope `constexpr char name[]` of 1 to 32 tokens.
+ *
+ * @code
+ * constexpr char kErrorCode[] = "E[0-9][0-9][0-9]";
+ * StringView code = ShiftOrMatcher<kErrorCode>::find(logLine);
+ * @endcode
+ */
+template<const char* Pattern>
+class ShiftOrMatcher {
+  static constexpr size_t kLen = view_detail::cstrnlen(Pattern, 255);
+  static constexpr size_t kTokens = view_detail::tokenCount(Pattern, kLen, false);
+  static_assert(kTokens >= 1 && kTokens <= 32, "ShiftOrMatcher patterns have 1 to 32 tokens");
+  typedef typename view_detail::MaskFor<kTokens>::type Mask;
+  typedef view_detail::PatternMasks<Pattern, false, Mask> Masks;
+
+public:
+  /** @brief Number of characters a match spans. */
+  static constexpr size_t matchLength() { return kTokens; }
+
+  /** @brief First match at or after from, or an empty view with a null data(). */
+  static StringView find(const StringView& text, size_t from = 0) {
+    typedef view_detail::FlashTable<Mask, typename Masks::Table, view_detail::MakeIndexSeq<256>::type> Table;
+    const Mask* table = Table::data();
+    const Mask done = (Mask)((Mask)1 << (kTokens - 1));
+    Mask state = (Mask)~0;
+    for (size_t i = from; i < text.length(); i++) {
+      state = (Mask)((Mask)(state << 1) | view_detail::flashRead(&table[(uint8_t)text[i]]));
+      if (!(state & done)) return StringView(text.data() + i + 1 - kTokens, kTokens);
+    }
+    return StringView();
+  }
+
+  /** @brief Checks if the pattern occurs in text. */
+  static bool contains(const StringView& text) { return find(text).data() != nullptr; }
+};
+
+#endif
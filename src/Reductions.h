@@ -0,0 +1,221 @@
+#ifndef REDUCTIONS_H
+#define REDUCTIONS_H
+
+#include "Views.h"
+#include <math.h>
+
+/**
+ * @brief Use the ARM DSP-extension dual 16-bit multiply-accumulate (SMLALD)
+ * for int16_t dot() and sumSquares(). On by default for Cortex-M4/M7/M33/M55
+ * builds with a compiler that provides the ACLE intrinsics.
+ */
+#ifndef VIEWS_USE_ARM_SIMD32
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32 && (defined(__clang__) || __GNUC__ >= 10)
+#define VIEWS_USE_ARM_SIMD32 1
+#else
+#define VIEWS_USE_ARM_SIMD32 0
+#endif
+#endif
+
+/**
+ * @brief Route float and int16_t dot()/sumSquares() to CMSIS-DSP
+ * (arm_dot_prod_f32 / arm_dot_prod_q15), which has Helium (MVE) kernels on
+ * Cortex-M55/M85. Off by default: define to 1 when the sketch links CMSIS-DSP.
+ * The q15 kernel accumulates exactly in 64 bits, so int16_t results equal the
+ * scalar code. arm_dot_prod_f32 adds in a different order, so float results
+ * may differ from it in the last bits.
+ */
+#ifndef VIEWS_USE_CMSIS_DSP
+#define VIEWS_USE_CMSIS_DSP 0
+#endif
+
+#if VIEWS_USE_ARM_SIMD32
+#include <arm_acle.h>
+#endif
+#if VIEWS_USE_CMSIS_DSP
+#include <arm_math.h>
+#endif
+
+namespace view_detail {
+
+/** @brief Signedness of the fundamental integer types (not int32_t & co., which alias them). */
+template<typename T> struct IntTraits { static const bool isInt = false; static const bool isSigned = false; };
+template<> struct IntTraits<char> { static const bool isInt = true; static const bool isSigned = (char)-1 < 0; };
+template<> struct IntTraits<signed char> { static const bool isInt = true; static const bool isSigned = true; };
+template<> struct IntTraits<unsigned char> { static const bool isInt = true; static const bool isSigned = false; };
+template<> struct IntTraits<short> { static const bool isInt = true; static const bool isSigned = true; };
+template<> struct IntTraits<unsigned short> { static const bool isInt = true; static const bool isSigned = false; };
+template<> struct IntTraits<int> { static const bool isInt = true; static const bool isSigned = true; };
+template<> struct IntTraits<unsigned int> { static const bool isInt = true; static const bool isSigned = false; };
+template<> struct IntTraits<long> { static const bool isInt = true; static const bool isSigned = true; };
+template<> struct IntTraits<unsigned long> { static const bool isInt = true; static const bool isSigned = false; };
+template<> struct IntTraits<long long> { static const bool isInt = true; static const bool isSigned = true; };
+template<> struct IntTraits<unsigned long long> { static const bool isInt = true; static const bool isSigned = false; };
+
+template<bool Signed, size_t Bytes> struct IntOfSize;
+template<> struct IntOfSize<true, 4> { typedef int32_t type; };
+template<> struct IntOfSize<false, 4> { typedef uint32_t type; };
+template<> struct IntOfSize<true, 8> { typedef int64_t type; };
+template<> struct IntOfSize<false, 8> { typedef uint64_t type; };
+
+/**
+ * @brief Accumulator for sum(): integers under 4 bytes sum into 32 bits and
+ * 4-byte ones into 64 bits, chosen by size so that int and long work whichever
+ * of them int32_t is; 64-bit integers and floating point keep their own type.
+ */
+template<typename T, bool = IntTraits<T>::isInt> struct SumType { typedef T type; };
+template<typename T> struct SumType<T, true> {
+  typedef typename IntOfSize<IntTraits<T>::isSigned, (sizeof(T) < 4) ? 4 : 8>::type type;
+};
+
+/** @brief Accumulator for dot() and sumSquares(): products need twice the bits. */
+template<typename T, bool = IntTraits<T>::isInt> struct ProductType { typedef T type; };
+template<typename T> struct ProductType<T, true> {
+  typedef typename IntOfSize<IntTraits<T>::isSigned, (sizeof(T) < 2) ? 4 : 8>::type type;
+};
+
+/** @brief Result type of mean() and rms(): double for double data, float otherwise. */
+template<typename T> struct RealType { typedef float type; };
+template<> struct RealType<double> { typedef double type; };
+
+/** @brief Four-way unrolled sum of f(a[i], b[i]); independent accumulators hide latency. */
+template<typename Acc, typename T, typename F>
+Acc reduce(const T* a, const T* b, size_t n, F f) {
+  Acc s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    s0 += f(a[i], b[i]);
+    s1 += f(a[i + 1], b[i + 1]);
+    s2 += f(a[i + 2], b[i + 2]);
+    s3 += f(a[i + 3], b[i + 3]);
+  }
+  for (; i < n; i++) s0 += f(a[i], b[i]);
+  return (s0 + s1) + (s2 + s3);
+}
+
+template<typename Acc>
+struct Identity {
+  template<typename T> Acc operator()(const T& a, const T&) const { return (Acc)a; }
+};
+
+template<typename Acc>
+struct Product {
+  template<typename T> Acc operator()(const T& a, const T& b) const { return (Acc)a * (Acc)b; }
+};
+
+template<typename T>
+typename ProductType<T>::type dotKernel(const T* a, const T* b, size_t n) {
+  typedef typename ProductType<T>::type Acc;
+  return reduce<Acc>(a, b, n, Product<Acc>());
+}
+
+#if VIEWS_USE_CMSIS_DSP
+inline float dotKernel(const float* a, const float* b, size_t n) {
+  float32_t r;
+  arm_dot_prod_f32((float32_t*)a, (float32_t*)b, (uint32_t)n, &r);
+  return r;
+}
+
+inline int64_t dotKernel(const int16_t* a, const int16_t* b, size_t n) {
+  q63_t r;
+  arm_dot_prod_q15((q15_t*)a, (q15_t*)b, (uint32_t)n, &r);
+  return r;
+}
+#elif VIEWS_USE_ARM_SIMD32
+/** @brief Two 16x16 products per SMLALD, accumulated exactly in 64 bits. */
+inline int64_t dotKernel(const int16_t* a, const int16_t* b, size_t n) {
+  int64_t acc = 0;
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    int32_t x, y;
+    memcpy(&x, a + i, 4);
+    memcpy(&y, b + i, 4);
+    acc = __smlald(x, y, acc);
+  }
+  if (i < n) acc += (int32_t)a[i] * b[i];
+  return acc;
+}
+#endif
+
+} // namespace view_detail
+
+/** @brief Smallest and largest element and their first indices. */
+template<typename T>
+struct MinMax {
+  T min;
+  T max;
+  size_t minIndex;
+  size_t maxIndex;
+};
+
+/**
+ * @brief Sum of the elements in a wider accumulator: 8/16-bit integers sum
+ * into 32 bits (exact for up to 65536 full-scale int16 samples), 32-bit integers
+ * into 64 bits, floating point in its own type.
+ */
+template<typename T>
+typename view_detail::SumType<T>::type sum(const MemoryView<T>& v) {
+  typedef typename view_detail::SumType<T>::type Acc;
+  return view_detail::reduce<Acc>(v.data(), v.data(), v.length(), view_detail::Identity<Acc>());
+}
+
+/** @brief Minimum and maximum in one pass (value-initialised for an empty view). */
+template<typename T>
+MinMax<T> minMax(const MemoryView<T>& v) {
+  MinMax<T> r = {T(), T(), 0, 0};
+  size_t n = v.length();
+  if (n == 0) return r;
+  const T* d = v.data();
+  r.min = r.max = d[0];
+  for (size_t i = 1; i < n; i++) {
+    if (d[i] < r.min) {
+      r.min = d[i];
+      r.minIndex = i;
+    }
+    if (r.max < d[i]) {
+      r.max = d[i];
+      r.maxIndex = i;
+    }
+  }
+  return r;
+}
+
+/** @brief Arithmetic mean (0 for an empty view). */
+template<typename T>
+typename view_detail::RealType<T>::type mean(const MemoryView<T>& v) {
+  typedef typename view_detail::RealType<T>::type R;
+  return v.isEmpty() ? (R)0 : (R)sum(v) / (R)v.length();
+}
+
+/**
+ * @brief Sum of a[i] * b[i] over the shorter length, in a double-width
+ * accumulator (int16_t products sum exactly into int64_t).
+ */
+template<typename T>
+typename view_detail::ProductType<T>::type dot(const MemoryView<T>& a, const MemoryView<T>& b) {
+  size_t n = (a.length() < b.length()) ? a.length() : b.length();
+  return view_detail::dotKernel(a.data(), b.data(), n);
+}
+
+/** @brief Sum of squares (the energy of a window), exact for integer types. */
+template<typename T>
+typename view_detail::ProductType<T>::type sumSquares(const MemoryView<T>& v) {
+  return view_detail::dotKernel(v.data(), v.data(), v.length());
+}
+
+/** @brief Root mean square (0 for an empty view). */
+template<typename T>
+typename view_detail::RealType<T>::type rms(const MemoryView<T>& v) {
+  typedef typename view_detail::RealType<T>::type R;
+  return v.isEmpty() ? (R)0 : (R)sqrt((double)sumSquares(v) / (double)v.length());
+}
+
+/** @brief Number of elements for which pred(element) is true. */
+template<typename T, typename Pred>
+size_t countIf(const MemoryView<T>& v, Pred pred) {
+  size_t count = 0;
+  for (size_t i = 0; i < v.length(); i++) count += pred(v[i]) ? 1 : 0;
+  return count;
+}
+
+#endif
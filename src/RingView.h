@@ -0,0 +1,252 @@
+#ifndef RING_VIEW_H
+#define RING_VIEW_H
+
+#include "Views.h"
+
+/**
+ * @class RingView
+ * @brief A read-only view of a region of a circular buffer that may wrap.
+ * @tparam T The type of the data elements.
+ *
+ * The region is held as two MemoryView segments (the second is empty when
+ * the region does not wrap) behind one index space [0, length()). Searching,
+ * slicing and tokenizing work across the wrap point without copying; call
+ * linearize() only when contiguous memory is really needed.
+ */
+template<typename T>
+class RingView {
+public:
+  /** @brief Default constructor creating an empty view. */
+  RingView() {}
+
+  /** @brief Joins two segments; index 0 is the start of first. */
+  RingView(const MemoryView<T>& first, const MemoryView<T>& second)
+    : _first(first.isEmpty() ? second : first), _second(first.isEmpty() ? MemoryView<T>() : second) {}
+
+  /**
+   * @brief Views count elements of a circular buffer starting at index start.
+   * @param buffer The ring storage.
+   * @param capacity Number of elements in the storage.
+   * @param start Index of the oldest element (the read position).
+   * @param count Number of elements available (at most capacity).
+   */
+  RingView(const T* buffer, size_t capacity, size_t start, size_t count) {
+    if (capacity == 0) return;
+    if (start >= capacity) start %= capacity;
+    if (count > capacity) count = capacity;
+    size_t head = capacity - start;
+    if (count <= head) {
+      _first = MemoryView<T>(buffer + start, count);
+    } else {
+      _first = MemoryView<T>(buffer + start, head);
+      _second = MemoryView<T>(buffer, count - head);
+    }
+  }
+
+  // --- Accessors ---
+
+  /** @brief Total number of elements in both segments. */
+  size_t length() const { return _first.length() + _second.length(); }
+
+  /** @brief Returns true if the length is 0. */
+  bool isEmpty() const { return length() == 0; }
+
+  /** @brief True if the region does not wrap (one segment). */
+  bool isContiguous() const { return _second.isEmpty(); }
+
+  /** @brief Segment before the wrap point. */
+  const MemoryView<T>& first() const { return _first; }
+
+  /** @brief Segment after the wrap point (empty if none). */
+  const MemoryView<T>& second() const { return _second; }
+
+  /** @brief Accesses an element by logical index. */
+  const T& operator[](size_t index) const {
+    size_t n = _first.length();
+    return (index < n) ? _first[index] : _second[index - n];
+  }
+
+  /** @brief Creates a sub-view by logical index (same rules as MemoryView::slice). */
+  RingView<T> slice(size_t start, size_t length = 0xFFFFFFFF) const {
+    size_t total = this->length();
+    if (start >= total) return RingView<T>();
+    if (length > total - start) length = total - start;
+    size_t n = _first.length();
+    if (start >= n) return RingView<T>(_second.slice(start - n, length), MemoryView<T>());
+    size_t inFirst = n - start;
+    if (length <= inFirst) return RingView<T>(_first.slice(start, length), MemoryView<T>());
+    return RingView<T>(_first.slice(start), _second.slice(0, length - inFirst));
+  }
+
+  // --- Search ---
+
+  /** @brief Finds the first index of a value at or after from; -1 if not found. */
+  int indexOf(const T& value, size_t from = 0) const {
+    size_t n = _first.length();
+    if (from < n) {
+      int pos = _first.indexOf(value, from);
+      if (pos != -1) return pos;
+      from = n;
+    }
+    int pos = _second.indexOf(value, from - n);
+    return (pos == -1) ? -1 : (int)(pos + n);
+  }
+
+  /** @brief Finds the first index of a pattern, including matches that straddle the wrap. */
+  int indexOf(const MemoryView<T>& pattern, size_t from = 0) const {
+    size_t m = pattern.length();
+    size_t total = length();
+    if (m == 0 || from > total || m > total - from) return -1;
+    size_t n = _first.length();
+    if (from < n) {
+      int pos = _first.indexOf(pattern, from);
+      if (pos != -1) return pos;
+      // Candidates starting in the last m - 1 elements of the first segment.
+      size_t i = (n + 1 > m && n + 1 - m > from) ? n + 1 - m : from;
+      for (; i < n && i + m <= total; i++) {
+        int hit = _first.indexOf(pattern[0], i);
+        if (hit == -1) break;
+        i = (size_t)hit;
+        if (i + m <= total && matchesAt(i, pattern)) return (int)i;
+      }
+      from = n;
+    }
+    int pos = _second.indexOf(pattern, from - n);
+    return (pos == -1) ? -1 : (int)(pos + n);
+  }
+
+  /** @brief Checks if a value exists within the view. */
+  bool contains(const T& value) const { return indexOf(value) != -1; }
+
+  /** @brief Checks if a pattern exists within the view. */
+  bool contains(const MemoryView<T>& pattern) const { return indexOf(pattern) != -1; }
+
+  /** @brief True if pattern occurs at logical index at. */
+  bool matchesAt(size_t at, const MemoryView<T>& pattern) const {
+    size_t m = pattern.length();
+    size_t total = length();
+    if (at > total || m > total - at) return false;
+    size_t n = _first.length();
+    size_t inFirst = (at < n) ? ((n - at < m) ? n - at : m) : 0;
+    const T* p = pattern.data();
+    if (inFirst && !view_detail::Ops<T>::equal(_first.data() + at, p, inFirst)) return false;
+    size_t rest = m - inFirst;
+    size_t off = (at > n) ? at - n : 0;
+    return rest == 0 || view_detail::Ops<T>::equal(_second.data() + off, p + inFirst, rest);
+  }
+
+  /** @brief Prefix check across the wrap. */
+  bool startsWith(const MemoryView<T>& prefix) const { return matchesAt(0, prefix); }
+
+  /** @brief Content equality with a contiguous view. */
+  bool equals(const MemoryView<T>& other) const {
+    return other.length() == length() && matchesAt(0, other);
+  }
+
+  /**
+   * @brief Tokenize by a delimiter value; the token may span the wrap.
+   * Same offset contract as StringView::nextToken.
+   */
+  RingView<T> nextToken(const T& delim, size_t& offset) const {
+    size_t total = length();
+    if (offset >= total) return RingView<T>();
+    int pos = indexOf(delim, offset);
+    size_t end = (pos == -1) ? total : (size_t)pos;
+    RingView<T> token = slice(offset, end - offset);
+    offset = (pos == -1) ? total : end + 1;
+    return token;
+  }
+
+  // --- Linearization ---
+
+  /**
+   * @brief Copies the elements into dst[0, capacity).
+   * @return Number of elements copied (truncated to capacity).
+   */
+  size_t copyTo(T* dst, size_t capacity) const {
+    size_t a = (_first.length() < capacity) ? _first.length() : capacity;
+    size_t b = (_second.length() < capacity - a) ? _second.length() : capacity - a;
+    copyRange(dst, _first.data(), a);
+    copyRange(dst + a, _second.data(), b);
+    return a + b;
+  }
+
+  /**
+   * @brief Returns the region as one contiguous view. When it does not wrap
+   * this is the first segment itself; otherwise it is copied into scratch.
+   * Returns an empty view if scratch is too small.
+   */
+  MemoryView<T> linearize(T* scratch, size_t capacity) const {
+    if (isContiguous()) return _first;
+    if (length() > capacity) return MemoryView<T>();
+    return MemoryView<T>(scratch, copyTo(scratch, capacity));
+  }
+
+protected:
+  static void copyRange(T* dst, const T* src, size_t n) { view_detail::CopyOps<T>::copy(dst, src, n); }
+
+  MemoryView<T> _first;
+  MemoryView<T> _second;
+};
+
+/**
+ * @class RingStringView
+ * @brief RingView<char> with StringView-style overloads (C-strings, literals)
+ * and printing of both segments.
+ */
+class RingStringView : public RingView<char>, public Printable {
+public:
+  /** @brief Default constructor creating an empty view. */
+  RingStringView() {}
+
+  /** @brief Joins two segments; index 0 is the start of first. */
+  RingStringView(const StringView& first, const StringView& second) : RingView<char>(first, second) {}
+
+  /** @brief Views count characters of a circular buffer starting at start. */
+  RingStringView(const char* buffer, size_t capacity, size_t start, size_t count)
+    : RingView<char>(buffer, capacity, start, count) {}
+
+  /** @brief Promote RingView<char> to RingStringView. */
+  RingStringView(const RingView<char>& base) : RingView<char>(base) {}
+
+  RingStringView slice(size_t start, size_t length = 0xFFFFFFFF) const {
+    return RingView<char>::slice(start, length);
+  }
+
+  int indexOf(char c, size_t from = 0) const { return RingView<char>::indexOf(c, from); }
+  int indexOf(const StringView& s, size_t from = 0) const { return RingView<char>::indexOf(s, from); }
+  bool contains(char c) const { return RingView<char>::contains(c); }
+  bool contains(const StringView& s) const { return RingView<char>::contains(s); }
+  bool startsWith(const StringView& prefix) const { return RingView<char>::startsWith(prefix); }
+  bool equals(const StringView& other) const { return RingView<char>::equals(other); }
+  bool operator==(const StringView& other) const { return equals(other); }
+
+  /** @brief Tokenize by character. Updates offset for next call. */
+  RingStringView nextToken(char delim, size_t& offset) const {
+    return RingView<char>::nextToken(delim, offset);
+  }
+
+  /** @brief Tokenize by string delimiter. Updates offset for next call. */
+  RingStringView nextToken(const StringView& delim, size_t& offset) const {
+    size_t total = length();
+    if (offset >= total) return RingStringView();
+    int pos = indexOf(delim, offset);
+    size_t end = (pos == -1) ? total : (size_t)pos;
+    RingStringView token = slice(offset, end - offset);
+    offset = (pos == -1) ? total : end + delim.length();
+    return token;
+  }
+
+  /** @brief The characters as a StringView (copied into scratch only if wrapped). */
+  StringView linearize(char* scratch, size_t capacity) const {
+    return RingView<char>::linearize(scratch, capacity);
+  }
+
+  /** @brief Printable interface implementation (both segments, no copy). */
+  size_t printTo(Print& p) const override {
+    return p.write(reinterpret_cast<const uint8_t*>(_first.data()), _first.length()) +
+           p.write(reinterpret_cast<const uint8_t*>(_second.data()), _second.length());
+  }
+};
+
+#endif
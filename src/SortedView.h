@@ -0,0 +1,147 @@
+#ifndef SORTED_VIEW_H
+#define SORTED_VIEW_H
+
+#include "Views.h"
+
+/**
+ * @class SortedView
+ * @brief A MemoryView whose type records that the data is sorted by Less, so
+ * indexOf and contains are binary searches (O(log n)) instead of scans.
+ * @tparam T The type of the data elements.
+ * @tparam Less Ordering functor (default: operator<).
+ *
+ * Sortedness is the caller's promise; check it once with isSorted() in
+ * debug builds if the table is not generated.
+ *
+ * @code
+ * static const uint16_t kKnownIds[] = {3, 17, 42, 230, 1024};
+ * SortedView<uint16_t> ids(kKnownIds);
+ * if (ids.contains(id)) ...
+ * @endcode
+ */
+template<typename T, typename Less = view_detail::Less>
+class SortedView : public MemoryView<T> {
+public:
+  /** @brief Default constructor creating an empty view. */
+  SortedView() {}
+
+  /** @brief Views data that is already sorted by less. */
+  explicit SortedView(const MemoryView<T>& sorted, Less less = Less())
+    : MemoryView<T>(sorted), _less(less) {}
+
+  /** @brief Views a whole sorted array. */
+  template<size_t N>
+  explicit SortedView(const T (&sorted)[N], Less less = Less())
+    : MemoryView<T>(sorted, N), _less(less) {}
+
+  /** @brief Index of the first element not ordered before value (length() if none). */
+  template<typename V>
+  size_t lowerBound(const V& value) const { return MemoryView<T>::lowerBound(value, _less); }
+
+  /** @brief Index of the first element ordered after value (length() if none). */
+  template<typename V>
+  size_t upperBound(const V& value) const { return MemoryView<T>::upperBound(value, _less); }
+
+  /** @brief Index of an element equivalent to value, or -1. */
+  template<typename V>
+  int indexOf(const V& value) const { return MemoryView<T>::binarySearch(value, _less); }
+
+  /** @brief Checks if an element equivalent to value exists. */
+  template<typename V>
+  bool contains(const V& value) const { return indexOf(value) != -1; }
+
+  /** @brief All elements equivalent to value (still sorted). */
+  template<typename V>
+  SortedView equalRange(const V& value) const {
+    return SortedView(MemoryView<T>::equalRange(value, _less), _less);
+  }
+
+  /** @brief Sub-views of sorted data are sorted. */
+  SortedView slice(size_t start, size_t length = 0xFFFFFFFF) const {
+    return SortedView(MemoryView<T>::slice(start, length), _less);
+  }
+
+  /** @brief The ordering. */
+  const Less& less() const { return _less; }
+
+private:
+  Less _less;
+};
+
+/**
+ * @class EytzingerView
+ * @brief Sorted lookups over a table stored in Eytzinger (breadth-first
+ * binary heap) order: the children of slot k are slots 2k and 2k + 1.
+ * @tparam T The type of the data elements.
+ * @tparam Less Ordering functor (default: operator<).
+ *
+ * A search walks down the array with a loop of one comparison and no
+ * branch on the result. The first few levels, visited by every lookup, share
+ * a handful of cache lines or flash-cache pages, instead of being spread
+ * over the whole table as in a sorted array. This is worthwhile for large
+ * tables on cached parts (ESP32, Cortex-M7); on cacheless MCUs a plain
+ * lowerBound() is as fast. Build the layout once with build(), or generate
+ * it offline.
+ */
+template<typename T, typename Less = view_detail::Less>
+class EytzingerView {
+public:
+  /** @brief Default constructor creating an empty view. */
+  EytzingerView() {}
+
+  /** @brief Views a table that is already in Eytzinger order. */
+  explicit EytzingerView(const MemoryView<T>& layout, Less less = Less())
+    : _table(layout), _less(less) {}
+
+  /**
+   * @brief Copies sorted data into out[0, sorted.length()) in Eytzinger
+   * order and returns a view of it.
+   */
+  static EytzingerView build(const MemoryView<T>& sorted, T* out, Less less = Less()) {
+    fill(sorted.data(), 0, out, 1, sorted.length());
+    return EytzingerView(MemoryView<T>(out, sorted.length()), less);
+  }
+
+  /** @brief The table in Eytzinger order. */
+  const MemoryView<T>& layout() const { return _table; }
+
+  /** @brief Number of elements. */
+  size_t length() const { return _table.length(); }
+
+  /** @brief Smallest element not ordered before value, or nullptr if none. */
+  template<typename V>
+  const T* lowerBound(const V& value) const {
+    const T* d = _table.data();
+    size_t n = _table.length();
+    size_t k = 1;
+    while (k <= n) k = 2 * k + (_less(d[k - 1], value) ? 1 : 0);
+    // The last left turn is the answer: drop the trailing right turns and it.
+    k >>= __builtin_ctzll(~(unsigned long long)k) + 1;
+    return k ? d + k - 1 : nullptr;
+  }
+
+  /** @brief Element equivalent to value, or nullptr. */
+  template<typename V>
+  const T* find(const V& value) const {
+    const T* p = lowerBound(value);
+    return (p && !_less(value, *p)) ? p : nullptr;
+  }
+
+  /** @brief Checks if an element equivalent to value exists. */
+  template<typename V>
+  bool contains(const V& value) const { return find(value) != nullptr; }
+
+private:
+  /** @brief In-order walk of the implicit tree; returns the next source index. */
+  static size_t fill(const T* src, size_t i, T* out, size_t k, size_t n) {
+    if (k > n) return i;
+    i = fill(src, i, out, 2 * k, n);
+    out[k - 1] = src[i++];
+    return fill(src, i, out, 2 * k + 1, n);
+  }
+
+  MemoryView<T> _table;
+  Less _less;
+};
+
+#endif
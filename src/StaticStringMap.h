@@ -0,0 +1,220 @@
+#ifndef STATIC_STRING_MAP_H
+#define STATIC_STRING_MAP_H
+
+#include "Views.h"
+
+namespace view_detail {
+
+/** @brief Smallest power of two >= n (n >= 1). */
+constexpr size_t nextPow2(size_t n, size_t p = 1) { return p >= n ? p : nextPow2(n, p * 2); }
+
+/** @brief Fixed byte pool keys are copied into; bytes are reclaimed by clear() only. */
+template<size_t Bytes>
+struct KeyPool {
+  static_assert(Bytes <= 0xFFFF, "StaticStringMap key pools are limited to 65535 bytes");
+  KeyPool() : used(0) {}
+  const char* store(const char* p, size_t n) {
+    if (n > Bytes - used) return nullptr;
+    char* dst = bytes + used;
+    if (n) memcpy(dst, p, n);
+    used = (uint16_t)(used + n);
+    return dst;
+  }
+  void clear() { used = 0; }
+  char bytes[Bytes];
+  uint16_t used;
+};
+
+/** @brief No pool: keys stay where the caller keeps them. */
+template<>
+struct KeyPool<0> {
+  static const uint16_t used = 0;
+  const char* store(const char* p, size_t) { return p; }
+  void clear() {}
+};
+
+} // namespace view_detail
+
+/**
+ * @class StaticStringMap
+ * @brief A fixed-capacity hash map from text keys to values, with no heap
+ * use: intern topic names, count device IDs, cache config keys found by the
+ * parsers.
+ * @tparam V Value type (default-constructible and copy-assignable).
+ * @tparam Capacity Maximum number of keys (1 to 16384).
+ * @tparam PoolBytes 0 to keep keys as views into caller-owned text, which
+ *         must stay valid and unchanged while the key is in the map. Otherwise
+ *         keys are copied into an internal pool of this many bytes, so
+ *         tokens from a reused receive buffer can be inserted.
+ *
+ * Open addressing with linear probing over a power-of-two table whose load
+ * stays at or below 80%. Each slot keeps the key's StringView::hash(), so a
+ * probe compares characters only when the full 32-bit hashes match: almost
+ * always one compare per lookup. remove() shifts displaced entries back
+ * instead of leaving tombstones. Pool bytes used by removed keys are reused
+ * only after clear().
+ *
+ * @code
+ * StaticStringMap<uint16_t, 32, 256> topics;     // keys copied: 256-byte pool
+ * uint16_t* hits = topics.findOrInsert(topic, 0);
+ * if (hits) ++*hits;
+ * @endcode
+ */
+template<typename V, size_t Capacity, size_t PoolBytes = 0>
+class StaticStringMap {
+  static_assert(Capacity >= 1 && Capacity <= 16384, "StaticStringMap holds 1 to 16384 keys");
+
+public:
+  /** @brief Number of slots in the table. */
+  static constexpr size_t kSlots = view_detail::nextPow2(Capacity + Capacity / 4 + 1);
+
+  /** @brief Creates an empty map. */
+  StaticStringMap() : _size(0) { clear(); }
+
+  // --- Lookup ---
+
+  /** @brief Value stored for key, or nullptr. */
+  V* find(const StringView& key) {
+    size_t i = slotOf(key, key.hash());
+    return isUsed(i) ? &_slots[i].value : nullptr;
+  }
+
+  /** @brief Value stored for key, or nullptr. */
+  const V* find(const StringView& key) const {
+    size_t i = slotOf(key, key.hash());
+    return isUsed(i) ? &_slots[i].value : nullptr;
+  }
+
+  /** @brief Checks if key is in the map. */
+  bool contains(const StringView& key) const { return find(key) != nullptr; }
+
+  /** @brief Value stored for key, or fallback. */
+  V get(const StringView& key, const V& fallback = V()) const {
+    const V* v = find(key);
+    return v ? *v : fallback;
+  }
+
+  /**
+   * @brief The map's own copy of key (from the pool, or the view first
+   * inserted), or an empty view if absent.
+   */
+  StringView keyOf(const StringView& key) const {
+    size_t i = slotOf(key, key.hash());
+    return isUsed(i) ? StringView(_slots[i].key, _slots[i].len) : StringView();
+  }
+
+  // --- Modification ---
+
+  /**
+   * @brief Stores value under key, replacing any previous value.
+   * @return False if the key is new and the map or the pool is full.
+   */
+  bool put(const StringView& key, const V& value) {
+    V* slot = findOrInsert(key, value);
+    if (slot) *slot = value;
+    return slot != nullptr;
+  }
+
+  /**
+   * @brief Value for key, inserting key with initial first if absent.
+   * @return nullptr if the key is new and the map or the pool is full, or
+   *         the key is longer than 65534 characters.
+   */
+  V* findOrInsert(const StringView& key, const V& initial = V()) {
+    uint32_t h = key.hash();
+    size_t i = slotOf(key, h);
+    if (isUsed(i)) return &_slots[i].value;
+    if (_size == Capacity || key.length() >= kEmpty) return nullptr;
+    const char* stored = _pool.store(key.data(), key.length());
+    if (!stored) return nullptr;
+    Slot& s = _slots[i];
+    s.key = stored;
+    s.len = (uint16_t)key.length();
+    s.hash = h;
+    s.value = initial;
+    _size++;
+    return &s.value;
+  }
+
+  /** @brief Removes key. @return False if it was not present. */
+  bool remove(const StringView& key) {
+    size_t i = slotOf(key, key.hash());
+    if (!isUsed(i)) return false;
+    // Backward-shift: pull later entries of the run into the hole when the
+    // hole lies between their home slot and where they are now.
+    for (size_t j = (i + 1) & kMask; isUsed(j); j = (j + 1) & kMask) {
+      size_t home = _slots[j].hash & kMask;
+      if (((j - home) & kMask) >= ((j - i) & kMask)) {
+        _slots[i] = _slots[j];
+        i = j;
+      }
+    }
+    _slots[i].len = kEmpty;
+    _slots[i].value = V();
+    _size--;
+    return true;
+  }
+
+  /** @brief Removes every key and empties the pool. */
+  void clear() {
+    for (size_t i = 0; i < kSlots; i++) {
+      _slots[i].len = kEmpty;
+      _slots[i].value = V();
+    }
+    _size = 0;
+    _pool.clear();
+  }
+
+  // --- State & Iteration ---
+
+  /** @brief Number of keys. */
+  size_t size() const { return _size; }
+
+  /** @brief Returns true if there are no keys. */
+  bool isEmpty() const { return _size == 0; }
+
+  /** @brief Maximum number of keys. */
+  size_t capacity() const { return Capacity; }
+
+  /** @brief Pool bytes taken by copied keys (0 without a pool). */
+  size_t poolUsed() const { return _pool.used; }
+
+  /** @brief Calls f(key, value) for every entry, in table (not insertion) order. */
+  template<typename F>
+  void forEach(F f) const {
+    for (size_t i = 0; i < kSlots; i++)
+      if (isUsed(i)) f(StringView(_slots[i].key, _slots[i].len), _slots[i].value);
+  }
+
+private:
+  static constexpr size_t kMask = kSlots - 1;
+  static constexpr uint16_t kEmpty = 0xFFFF; ///< len of an unused slot.
+
+  struct Slot {
+    const char* key;
+    uint32_t hash;
+    uint16_t len;
+    V value;
+  };
+
+  bool isUsed(size_t i) const { return _slots[i].len != kEmpty; }
+
+  /** @brief Slot holding key, or the empty slot that ends its probe run. */
+  size_t slotOf(const StringView& key, uint32_t h) const {
+    size_t n = key.length();
+    for (size_t i = h & kMask;; i = (i + 1) & kMask) {
+      const Slot& s = _slots[i];
+      if (s.len == kEmpty) return i;
+      if (s.hash == h && s.len == n && (n == 0 || memcmp(s.key, key.data(), n) == 0)) return i;
+    }
+  }
+
+  Slot _slots[kSlots];
+  size_t _size;
+  view_detail::KeyPool<PoolBytes> _pool;
+};
+
+template<typename V, size_t Capacity, size_t PoolBytes>
+constexpr size_t StaticStringMap<V, Capacity, PoolBytes>::kSlots;
+
+#endif
@@ -0,0 +1,229 @@
+#ifndef STRIDED_VIEW_H
+#define STRIDED_VIEW_H
+
+#include "Views.h"
+
+/**
+ * @class StridedView
+ * @brief A read-only view of every stride-th element: one channel of
+ * interleaved samples, or one column of a matrix, without copying.
+ * @tparam T The type of the data elements.
+ *
+ * @code
+ * // Stereo I2S DMA buffer: L R L R ...
+ * StridedView<int16_t> left = StridedView<int16_t>::channel(samples, 0, 2);
+ * for (int16_t s : left) peak = max(peak, abs(s));
+ * @endcode
+ */
+template<typename T>
+class StridedView {
+public:
+  /** @brief Forward iterator stepping by the stride. */
+  class iterator {
+  public:
+    iterator(const T* base, size_t stride, size_t i) : _base(base), _stride(stride), _i(i) {}
+    const T& operator*() const { return _base[_i * _stride]; }
+    iterator& operator++() {
+      _i++;
+      return *this;
+    }
+    bool operator==(const iterator& other) const { return _i == other._i; }
+    bool operator!=(const iterator& other) const { return _i != other._i; }
+
+  private:
+    const T* _base;
+    size_t _stride;
+    size_t _i;
+  };
+
+  /** @brief Default constructor creating an empty view. */
+  StridedView() : _data(nullptr), _len(0), _stride(1) {}
+
+  /**
+   * @brief Views length elements starting at data, stride elements apart.
+   * @param stride Distance between consecutive elements, in elements (>= 1).
+   */
+  StridedView(const T* data, size_t length, size_t stride)
+    : _data(data), _len(length), _stride(stride ? stride : 1) {}
+
+  /** @brief A contiguous view as a stride-1 view. */
+  StridedView(const MemoryView<T>& view) : _data(view.data()), _len(view.length()), _stride(1) {}
+
+  /**
+   * @brief Channel `index` of a buffer interleaving `channels` channels (empty
+   * if out of range). Bytes from DMA can be converted first:
+   * `StridedView<int16_t>::channel(dma.castTo<int16_t>(), 1, 4)`.
+   */
+  static StridedView<T> channel(const MemoryView<T>& interleaved, size_t index, size_t channels) {
+    if (channels == 0 || index >= channels || index >= interleaved.length()) return StridedView<T>();
+    return StridedView<T>(interleaved.data() + index,
+                          (interleaved.length() - index + channels - 1) / channels, channels);
+  }
+
+  // --- Accessors ---
+
+  /** @brief Address of the first element. */
+  const T* data() const { return _data; }
+
+  /** @brief Number of elements. */
+  size_t length() const { return _len; }
+
+  /** @brief Returns true if the length is 0. */
+  bool isEmpty() const { return _len == 0; }
+
+  /** @brief Distance between elements, in elements. */
+  size_t stride() const { return _stride; }
+
+  /** @brief True if the elements are adjacent (asMemoryView() is valid). */
+  bool isContiguous() const { return _stride == 1 || _len <= 1; }
+
+  /** @brief The view as a MemoryView; only meaningful when isContiguous(). */
+  MemoryView<T> asMemoryView() const { return isContiguous() ? MemoryView<T>(_data, _len) : MemoryView<T>(); }
+
+  /** @brief Accesses an element by index. */
+  const T& operator[](size_t index) const { return _data[index * _stride]; }
+
+  iterator begin() const { return iterator(_data, _stride, 0); }
+  iterator end() const { return iterator(_data, _stride, _len); }
+
+  // --- Sub-views ---
+
+  /** @brief Elements [start, start + length) (same rules as MemoryView::slice). */
+  StridedView<T> slice(size_t start, size_t length = 0xFFFFFFFF) const {
+    if (start >= _len) return StridedView<T>();
+    size_t avail = _len - start;
+    return StridedView<T>(_data + start * _stride, (length > avail) ? avail : length, _stride);
+  }
+
+  /** @brief Every factor-th element (decimation without copying). */
+  StridedView<T> step(size_t factor) const {
+    if (factor == 0) return StridedView<T>();
+    return StridedView<T>(_data, (_len + factor - 1) / factor, _stride * factor);
+  }
+
+  /**
+   * @brief Reads each element's address as a U instead, keeping the byte
+   * spacing. The byte stride must be a multiple of sizeof(U); otherwise the
+   * result is empty. `StridedView<uint8_t>(frame + 2, count, 8).castTo<int16_t>()`
+   * is the int16 at offset 2 of each of count 8-byte records.
+   * The first element's address must be aligned for U, since elements are
+   * read through a U pointer; use ByteReader for unaligned records.
+   */
+  template<typename U>
+  StridedView<U> castTo() const {
+    size_t bytes = _stride * sizeof(T);
+    if (bytes % sizeof(U) != 0) return StridedView<U>();
+    return StridedView<U>(reinterpret_cast<const U*>(_data), _len, bytes / sizeof(U));
+  }
+
+  // --- Search & Copy ---
+
+  /** @brief Finds the first index of a value at or after from; -1 if not found. */
+  int indexOf(const T& value, size_t from = 0) const {
+    for (size_t i = from; i < _len; i++)
+      if (_data[i * _stride] == value) return (int)i;
+    return -1;
+  }
+
+  /** @brief Checks if a value exists within the view. */
+  bool contains(const T& value) const { return indexOf(value) != -1; }
+
+  /**
+   * @brief Gathers the elements into dst[0, capacity) (de-interleaving one channel).
+   * @return Number of elements copied (truncated to capacity).
+   */
+  size_t copyTo(T* dst, size_t capacity) const {
+    size_t n = (_len < capacity) ? _len : capacity;
+    for (size_t i = 0; i < n; i++) dst[i] = _data[i * _stride];
+    return n;
+  }
+
+private:
+  const T* _data;
+  size_t _len;
+  size_t _stride;
+};
+
+/**
+ * @class MatrixView
+ * @brief A read-only rows x cols view over row-major data whose rows are
+ * rowStride elements apart (rowStride > cols describes padding, or a
+ * sub-matrix of a wider one).
+ * @tparam T The type of the data elements.
+ *
+ * For interleaved samples a row is one frame (all channels at one instant)
+ * and a column is one channel: `MatrixView<int16_t> frames(dma.castTo<int16_t>(), 4);`
+ * then `frames.col(2)` is channel 2 as a StridedView.
+ */
+template<typename T>
+class MatrixView {
+public:
+  /** @brief Default constructor creating an empty view. */
+  MatrixView() : _data(nullptr), _rows(0), _cols(0), _rowStride(0) {}
+
+  /** @brief Views rows x cols elements; rowStride defaults to cols (no padding). */
+  MatrixView(const T* data, size_t rows, size_t cols, size_t rowStride = 0)
+    : _data(data), _rows(rows), _cols(cols), _rowStride(rowStride ? rowStride : cols) {
+    if (_rowStride < _cols) _rows = _cols = 0;
+  }
+
+  /** @brief Splits a contiguous view into rows of cols elements (a partial last row is dropped). */
+  MatrixView(const MemoryView<T>& view, size_t cols)
+    : _data(view.data()), _rows(cols ? view.length() / cols : 0), _cols(cols), _rowStride(cols) {}
+
+  // --- Accessors ---
+
+  /** @brief Address of element (0, 0). */
+  const T* data() const { return _data; }
+
+  /** @brief Number of rows. */
+  size_t rows() const { return _rows; }
+
+  /** @brief Number of columns. */
+  size_t cols() const { return _cols; }
+
+  /** @brief Distance between the starts of consecutive rows, in elements. */
+  size_t rowStride() const { return _rowStride; }
+
+  /** @brief Returns true if there are no elements. */
+  bool isEmpty() const { return _rows == 0 || _cols == 0; }
+
+  /** @brief Accesses element (row, col). */
+  const T& operator()(size_t row, size_t col) const { return _data[row * _rowStride + col]; }
+
+  // --- Sub-views ---
+
+  /** @brief Row r as a contiguous view (empty if out of range). */
+  MemoryView<T> row(size_t r) const {
+    return (r < _rows) ? MemoryView<T>(_data + r * _rowStride, _cols) : MemoryView<T>();
+  }
+
+  /** @brief Column c as a strided view (empty if out of range). */
+  StridedView<T> col(size_t c) const {
+    return (c < _cols) ? StridedView<T>(_data + c, _rows, _rowStride) : StridedView<T>();
+  }
+
+  /** @brief The sub-matrix of rows [row, row + rows) and columns [col, col + cols), clamped. */
+  MatrixView<T> slice(size_t row, size_t col, size_t rows = 0xFFFFFFFF, size_t cols = 0xFFFFFFFF) const {
+    if (row >= _rows || col >= _cols) return MatrixView<T>();
+    if (rows > _rows - row) rows = _rows - row;
+    if (cols > _cols - col) cols = _cols - col;
+    return MatrixView<T>(_data + row * _rowStride + col, rows, cols, _rowStride);
+  }
+
+  /** @brief Rows [start, start + count) (whole rows). */
+  MatrixView<T> rowsFrom(size_t start, size_t count = 0xFFFFFFFF) const { return slice(start, 0, count); }
+
+  /** @brief The elements as one MemoryView when rows are not padded. */
+  MemoryView<T> asMemoryView() const {
+    return (_rowStride == _cols) ? MemoryView<T>(_data, _rows * _cols) : MemoryView<T>();
+  }
+
+private:
+  const T* _data;
+  size_t _rows;
+  size_t _cols;
+  size_t _rowStride;
+};
+
+#endif
@@ -0,0 +1,349 @@
+#ifndef UTF8_H
+#define UTF8_H
+
+#include "Views.h"
+
+namespace view_detail {
+
+// UTF-8 validation as a DFA over byte classes (RFC 3629: no overlongs,
+// surrogates or code points above U+10FFFF). Both tables are built by the
+// compiler into flash.
+
+const uint8_t kUtf8Accept = 0;
+const uint8_t kUtf8Reject = 1;
+const uint8_t kUtf8Classes = 12;
+
+/**
+ * @brief Byte class: 0 ASCII; 1-3 continuation 80-8F, 90-9F, A0-BF; 4 lead of
+ * 2; 5 E0; 6 other lead of 3; 7 ED; 8 F0; 9 F1-F3; 10 F4; 11 never valid.
+ */
+constexpr uint8_t utf8Class(uint8_t b) {
+  return b < 0x80 ? 0 : b < 0x90 ? 1 : b < 0xA0 ? 2 : b < 0xC0 ? 3
+       : b < 0xC2 ? 11 : b < 0xE0 ? 4 : b == 0xE0 ? 5 : b == 0xED ? 7 : b < 0xF0 ? 6
+       : b == 0xF0 ? 8 : b < 0xF4 ? 9 : b == 0xF4 ? 10 : 11;
+}
+
+/**
+ * @brief DFA transition. States: 0 accept, 1 reject, 2/3/6 expect 1/2/3 more
+ * continuation bytes, 4 after E0 (A0-BF next), 5 after ED (80-9F next), 7
+ * after F0 (90-BF next), 8 after F4 (80-8F next).
+ */
+constexpr uint8_t utf8Next(uint8_t state, uint8_t cls) {
+  return state == kUtf8Accept
+         ? (cls == 0 ? 0 : cls == 4 ? 2 : cls == 5 ? 4 : cls == 6 ? 3 : cls == 7 ? 5
+            : cls == 8 ? 7 : cls == 9 ? 6 : cls == 10 ? 8 : kUtf8Reject)
+       : (cls < 1 || cls > 3) ? kUtf8Reject
+       : state == 2 ? 0 : state == 3 ? 2 : state == 6 ? 3
+       : state == 4 ? (cls == 3 ? 2 : kUtf8Reject)
+       : state == 5 ? (cls < 3 ? 2 : kUtf8Reject)
+       : state == 7 ? (cls > 1 ? 3 : kUtf8Reject)
+       : state == 8 ? (cls == 1 ? 3 : kUtf8Reject)
+       : kUtf8Reject;
+}
+
+struct Utf8ClassGen {
+  static constexpr uint8_t at(size_t b) { return utf8Class((uint8_t)b); }
+};
+struct Utf8StateGen {
+  static constexpr uint8_t at(size_t i) { return utf8Next((uint8_t)(i / kUtf8Classes), (uint8_t)(i % kUtf8Classes)); }
+};
+typedef FlashTable<uint8_t, Utf8ClassGen, MakeIndexSeq<256>::type> Utf8ClassTable;
+typedef FlashTable<uint8_t, Utf8StateGen, MakeIndexSeq<9 * kUtf8Classes>::type> Utf8StateTable;
+
+inline uint8_t utf8ByteClass(uint8_t b) { return VIEWS_FLASH_BYTE(Utf8ClassTable::data() + b); }
+
+inline uint8_t utf8Step(uint8_t state, uint8_t cls) {
+  return VIEWS_FLASH_BYTE(Utf8StateTable::data() + state * kUtf8Classes + cls);
+}
+
+/** @brief Length of the ASCII run at the start of d[0, n), a word at a time where enabled. */
+inline size_t asciiPrefix(const uint8_t* d, size_t n) {
+  size_t i = 0;
+#if VIEWS_USE_SWAR
+  for (; i < n && !isWordAligned(d + i); i++)
+    if (d[i] & 0x80) return i;
+  for (; i + sizeof(Word) <= n; i += sizeof(Word))
+    if (loadWord(d + i) & kHighBits) break;
+#endif
+  for (; i < n; i++)
+    if (d[i] & 0x80) return i;
+  return n;
+}
+
+/** @brief Marker for an invalid sequence in utf8Decode (never a code point). */
+const uint32_t kUtf8Invalid = 0xFFFFFFFFUL;
+
+/**
+ * @brief Decodes the sequence at p (p < end) into cp.
+ * @return Bytes consumed. An invalid or truncated sequence yields
+ *         kUtf8Invalid and consumes its maximal valid prefix (at least one
+ *         byte), as the Unicode "substitution of maximal subparts" advises.
+ */
+inline size_t utf8Decode(const uint8_t* p, const uint8_t* end, uint32_t& cp) {
+  if (*p < 0x80) {
+    cp = *p;
+    return 1;
+  }
+  uint8_t state = kUtf8Accept;
+  uint32_t v = 0;
+  const uint8_t* q = p;
+  while (q < end) {
+    uint8_t cls = utf8ByteClass(*q);
+    uint8_t next = utf8Step(state, cls);
+    if (next == kUtf8Reject) break;
+    v = (state == kUtf8Accept) ? (uint32_t)(*q & (0xFF >> (cls == 4 ? 3 : cls < 8 ? 4 : 5)))
+                               : (v << 6) | (*q & 0x3F);
+    q++;
+    state = next;
+    if (state == kUtf8Accept) {
+      cp = v;
+      return (size_t)(q - p);
+    }
+  }
+  cp = kUtf8Invalid;
+  return (q == p) ? 1 : (size_t)(q - p);
+}
+
+/** @brief Bytes of the longest prefix of d[0, n) made of complete, valid sequences. */
+inline size_t utf8ValidLength(const uint8_t* d, size_t n) {
+  size_t i = asciiPrefix(d, n), good = i;
+  uint8_t state = kUtf8Accept;
+  while (i < n) {
+    uint8_t b = d[i++];
+    state = utf8Step(state, utf8ByteClass(b));
+    if (state == kUtf8Reject) return good;
+    if (state == kUtf8Accept) {
+      if (b < 0x80) i += asciiPrefix(d + i, n - i);
+      good = i;
+    }
+  }
+  return good;
+}
+
+/** @brief Bytes in the sequence led by b, for text known to be valid. */
+inline uint8_t utf8SequenceLength(uint8_t b) { return (uint8_t)(1 + (b >= 0xC0) + (b >= 0xE0) + (b >= 0xF0)); }
+
+inline bool isAsciiSpace(uint8_t c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+} // namespace view_detail
+
+/** @brief True if text is well-formed UTF-8 (ASCII runs are checked a word at a time). */
+inline bool isValidUtf8(const StringView& text) {
+  return view_detail::utf8ValidLength(reinterpret_cast<const uint8_t*>(text.data()), text.length()) ==
+         text.length();
+}
+
+/**
+ * @brief Bytes of the longest well-formed prefix of text. For a stream
+ * received in pieces, text[result, length()) is either invalid or the start
+ * of a sequence that continues in the next piece.
+ */
+inline size_t utf8ValidPrefix(const StringView& text) {
+  return view_detail::utf8ValidLength(reinterpret_cast<const uint8_t*>(text.data()), text.length());
+}
+
+/**
+ * @class Utf8Iterator
+ * @brief Forward iterator yielding the code points of UTF-8 bytes. Invalid
+ * sequences yield U+FFFD, one per maximal invalid subpart.
+ */
+class Utf8Iterator {
+public:
+  Utf8Iterator(const char* p, const char* end)
+    : _p(reinterpret_cast<const uint8_t*>(p)), _end(reinterpret_cast<const uint8_t*>(end)), _cp(0), _len(0) {
+    decode();
+  }
+
+  /** @brief The current code point. */
+  uint32_t operator*() const { return _cp; }
+
+  Utf8Iterator& operator++() {
+    _p += _len;
+    decode();
+    return *this;
+  }
+
+  bool operator==(const Utf8Iterator& other) const { return _p == other._p; }
+  bool operator!=(const Utf8Iterator& other) const { return _p != other._p; }
+
+  /** @brief Address of the current sequence's first byte. */
+  const char* position() const { return reinterpret_cast<const char*>(_p); }
+
+  /** @brief Bytes in the current sequence. */
+  size_t sequenceLength() const { return _len; }
+
+private:
+  void decode() {
+    if (_p >= _end) {
+      _len = 0;
+      return;
+    }
+    _len = (uint8_t)view_detail::utf8Decode(_p, _end, _cp);
+    if (_cp == view_detail::kUtf8Invalid) _cp = 0xFFFD;
+  }
+
+  const uint8_t* _p;
+  const uint8_t* _end;
+  uint32_t _cp;
+  uint8_t _len;
+};
+
+/**
+ * @class Utf8View
+ * @brief A StringView that counts, slices and iterates by code point, for
+ * labels and user text that must not be cut inside a multi-byte character.
+ *
+ * The constructor scans the bytes once and caches the length of the leading
+ * ASCII run, whether the text is valid and its code point count. Operations
+ * that stay within the ASCII run work on bytes directly, so pure ASCII text
+ * costs no more than a StringView. In invalid text each maximal invalid
+ * subpart counts as one code point (U+FFFD when iterated).
+ *
+ * @code
+ * Utf8View label(StringView(name));
+ * Utf8View shown = label.length() > 16 ? label.left(15) : label;   // whole characters
+ * for (uint32_t cp : shown) drawGlyph(cp);
+ * @endcode
+ */
+class Utf8View {
+public:
+  /** @brief An empty view. */
+  Utf8View() : _ascii(0), _count(0), _valid(true) {}
+
+  /** @brief Views bytes and scans them once. */
+  explicit Utf8View(const StringView& bytes) : _bytes(bytes) { scan(); }
+
+  // --- Properties ---
+
+  /** @brief The underlying bytes. */
+  const StringView& bytes() const { return _bytes; }
+
+  /** @brief Length in bytes. */
+  size_t byteLength() const { return _bytes.length(); }
+
+  /** @brief Length in code points (cached). */
+  size_t length() const { return _count; }
+
+  /** @brief Returns true if there are no bytes. */
+  bool isEmpty() const { return _bytes.length() == 0; }
+
+  /** @brief True if every byte is ASCII (cached). */
+  bool isAscii() const { return _ascii == _bytes.length(); }
+
+  /** @brief True if the bytes are well-formed UTF-8 (cached). */
+  bool isValid() const { return _valid; }
+
+  // --- Code point access ---
+
+  /** @brief Byte offset of code point index (byteLength() if index >= length()). */
+  size_t offsetOf(size_t index) const {
+    if (index <= _ascii) return index;
+    return advance(_ascii, index - _ascii);
+  }
+
+  /** @brief Code point at index, or 0 if index >= length(). O(index) outside the ASCII run. */
+  uint32_t codePointAt(size_t index) const {
+    size_t at = offsetOf(index);
+    if (at >= _bytes.length()) return 0;
+    return *Utf8Iterator(_bytes.data() + at, _bytes.data() + _bytes.length());
+  }
+
+  // --- Slicing ---
+
+  /** @brief count code points from code point start (clamped to the text). */
+  Utf8View slice(size_t start, size_t count = (size_t)-1) const {
+    size_t a = offsetOf(start);
+    if (a >= _bytes.length()) return Utf8View();
+    size_t avail = _count - start;
+    if (count > avail) count = avail;
+    size_t b = (count == avail) ? _bytes.length() : advance(a, count);
+    return Utf8View(StringView(_bytes.slice(a, b - a)), count, _valid);
+  }
+
+  /** @brief The first count code points. */
+  Utf8View left(size_t count) const { return slice(0, count); }
+
+  /** @brief The last count code points. */
+  Utf8View right(size_t count) const { return count >= _count ? *this : slice(_count - count); }
+
+  /**
+   * @brief The longest prefix of at most maxBytes bytes that does not end
+   * inside a sequence, e.g. to fill a fixed-size display or packet field.
+   */
+  Utf8View truncateBytes(size_t maxBytes) const {
+    if (maxBytes >= _bytes.length()) return *this;
+    if (maxBytes <= _ascii) return Utf8View(StringView(_bytes.data(), maxBytes), maxBytes, _valid);
+    const uint8_t* d = reinterpret_cast<const uint8_t*>(_bytes.data());
+    size_t end = maxBytes;
+    for (uint8_t back = 0; back < 3 && end > _ascii && (d[end] & 0xC0) == 0x80; back++) end--;
+    if ((d[end] & 0xC0) == 0x80) end = maxBytes;   // not a sequence: cut anywhere
+    return Utf8View(StringView(_bytes.data(), end));
+  }
+
+  /** @brief Removes ASCII whitespace from both ends (never touches bytes >= 0x80). */
+  Utf8View trim() const {
+    const uint8_t* d = reinterpret_cast<const uint8_t*>(_bytes.data());
+    size_t s = 0, e = _bytes.length();
+    while (s < e && view_detail::isAsciiSpace(d[s])) s++;
+    while (e > s && view_detail::isAsciiSpace(d[e - 1])) e--;
+    if (s == 0 && e == _bytes.length()) return *this;
+    if (isAscii()) return Utf8View(StringView(_bytes.data() + s, e - s), e - s, true);
+    return Utf8View(StringView(_bytes.data() + s, e - s), _count - s - (_bytes.length() - e), _valid);
+  }
+
+  // --- Iteration ---
+
+  Utf8Iterator begin() const { return Utf8Iterator(_bytes.data(), _bytes.data() + _bytes.length()); }
+  Utf8Iterator end() const {
+    return Utf8Iterator(_bytes.data() + _bytes.length(), _bytes.data() + _bytes.length());
+  }
+
+private:
+  /** @brief A sub-view whose count (and, if the parent was valid, validity) is known. */
+  Utf8View(const StringView& bytes, size_t count, bool parentValid) : _bytes(bytes), _count(count) {
+    _ascii = view_detail::asciiPrefix(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.length());
+    _valid = parentValid || view_detail::utf8ValidLength(reinterpret_cast<const uint8_t*>(bytes.data()),
+                                                         bytes.length()) == bytes.length();
+  }
+
+  void scan() {
+    const uint8_t* d = reinterpret_cast<const uint8_t*>(_bytes.data());
+    size_t n = _bytes.length();
+    _ascii = view_detail::asciiPrefix(d, n);
+    _count = _ascii;
+    _valid = true;
+    for (size_t i = _ascii; i < n;) {
+      uint32_t cp;
+      i += view_detail::utf8Decode(d + i, d + n, cp);
+      if (cp == view_detail::kUtf8Invalid) _valid = false;
+      _count++;
+      if (cp < 0x80) {
+        size_t run = view_detail::asciiPrefix(d + i, n - i);
+        i += run;
+        _count += run;
+      }
+    }
+  }
+
+  /** @brief Byte offset count code points after byte offset at. */
+  size_t advance(size_t at, size_t count) const {
+    const uint8_t* d = reinterpret_cast<const uint8_t*>(_bytes.data());
+    size_t n = _bytes.length();
+    for (; count > 0 && at < n; count--) {
+      if (_valid) {
+        at += view_detail::utf8SequenceLength(d[at]);
+      } else {
+        uint32_t cp;
+        at += view_detail::utf8Decode(d + at, d + n, cp);
+      }
+    }
+    return at < n ? at : n;
+  }
+
+  StringView _bytes;
+  size_t _ascii;   ///< Length of the leading ASCII run.
+  size_t _count;   ///< Code points.
+  bool _valid;
+};
+
+#endif
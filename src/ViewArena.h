@@ -0,0 +1,168 @@
+#ifndef VIEW_ARENA_H
+#define VIEW_ARENA_H
+
+#include "Views.h"
+
+/**
+ * @class BasicViewArena
+ * @brief A bump allocator over a caller-supplied buffer that keeps copies of
+ * views beyond the life of the buffer they came from, without `String` and
+ * without the heap.
+ *
+ * Each copy() is one memcpy and a pointer increment. Nothing is freed
+ * individually: reset() drops everything (e.g. once per message), and
+ * rollback() drops everything allocated after a mark(). A copy that does not
+ * fit returns an empty view and sets the overflow flag. Views returned by the
+ * arena are invalid once the bytes they point to are reset or rolled back.
+ * ViewArena<N> bundles the buffer.
+ */
+class BasicViewArena {
+public:
+  /** @brief Allocates from buffer[0, capacity). */
+  BasicViewArena(uint8_t* buffer, size_t capacity)
+    : _buf(buffer), _cap(buffer ? capacity : 0), _used(0), _overflow(false) {}
+
+  // --- Copying ---
+
+  /** @brief A copy of text that lives in the arena (empty if it does not fit). */
+  StringView copy(const StringView& text) {
+    char* p = static_cast<char*>(take(text.length(), 1));
+    if (!p) return StringView();
+    if (text.length()) memcpy(p, text.data(), text.length());
+    return StringView(p, text.length());
+  }
+
+  /** @brief A copy of the elements, aligned for T (empty if it does not fit). */
+  template<typename T>
+  MemoryView<T> copy(const MemoryView<T>& data) {
+    T* p = static_cast<T*>(take(data.length() * sizeof(T), alignof(T)));
+    if (!p) return MemoryView<T>();
+    if (data.length()) memcpy(p, data.data(), data.length() * sizeof(T));
+    return MemoryView<T>(p, data.length());
+  }
+
+  /**
+   * @brief A null-terminated copy of text for C APIs (strtok-free atoi, file
+   * names, ...) that costs length() + 1 bytes.
+   * @return nullptr if it does not fit.
+   */
+  const char* copyCString(const StringView& text) {
+    char* p = static_cast<char*>(take(text.length() + 1, 1));
+    if (!p) return nullptr;
+    if (text.length()) memcpy(p, text.data(), text.length());
+    p[text.length()] = '\0';
+    return p;
+  }
+
+  /**
+   * @brief Uninitialised room for count elements of T (e.g. to decode into).
+   * @return nullptr if it does not fit.
+   */
+  template<typename T>
+  T* allocate(size_t count) {
+    if (count > (size_t)-1 / sizeof(T)) {
+      _overflow = true;
+      return nullptr;
+    }
+    return static_cast<T*>(take(count * sizeof(T), alignof(T)));
+  }
+
+  // --- Lifetime ---
+
+  /** @brief Frees everything and clears the overflow flag. */
+  void reset() {
+    _used = 0;
+    _overflow = false;
+  }
+
+  /** @brief The current fill level, for a later rollback(). */
+  size_t mark() const { return _used; }
+
+  /** @brief Frees everything allocated since mark() returned m. */
+  void rollback(size_t m) {
+    if (m < _used) _used = m;
+  }
+
+  // --- State ---
+
+  /** @brief Bytes in the buffer. */
+  size_t capacity() const { return _cap; }
+
+  /** @brief Bytes allocated, including alignment padding. */
+  size_t used() const { return _used; }
+
+  /** @brief Bytes left (before any alignment padding). */
+  size_t remaining() const { return _cap - _used; }
+
+  /** @brief True if a copy or allocation did not fit since the last reset(). */
+  bool overflowed() const { return _overflow; }
+
+private:
+  void* take(size_t bytes, size_t align) {
+    size_t pad = (size_t)(-(uintptr_t)(_buf + _used) & (align - 1));
+    if (pad > _cap - _used || bytes > _cap - _used - pad) {
+      _overflow = true;
+      return nullptr;
+    }
+    uint8_t* p = _buf + _used + pad;
+    _used += pad + bytes;
+    return p;
+  }
+
+  uint8_t* _buf;
+  size_t _cap;
+  size_t _used;
+  bool _overflow;
+};
+
+/**
+ * @class ViewArena
+ * @brief A BasicViewArena with its own N-byte buffer, typically static or a
+ * member of the object handling messages.
+ *
+ * @code
+ * static ViewArena<256> arena;
+ * StringView deviceId = arena.copy(fields.field(2));   // survives the rx buffer
+ * ...
+ * arena.reset();                                        // next message
+ * @endcode
+ */
+template<size_t N>
+class ViewArena : public BasicViewArena {
+public:
+  ViewArena() : BasicViewArena(_storage, N) {}
+  ViewArena(const ViewArena&) = delete;
+  ViewArena& operator=(const ViewArena&) = delete;
+
+private:
+  alignas(8) uint8_t _storage[N];
+};
+
+/**
+ * @class ArenaScope
+ * @brief Marks an arena on construction and rolls it back on destruction,
+ * so temporaries decoded inside a block are freed when it ends.
+ *
+ * @code
+ * {
+ *   ArenaScope scratch(arena);
+ *   StringView decoded = ...;   // allocated from arena
+ * }                             // freed here
+ * @endcode
+ */
+class ArenaScope {
+public:
+  explicit ArenaScope(BasicViewArena& arena) : _arena(arena), _mark(arena.mark()) {}
+  ~ArenaScope() { _arena.rollback(_mark); }
+  ArenaScope(const ArenaScope&) = delete;
+  ArenaScope& operator=(const ArenaScope&) = delete;
+
+  /** @brief Keeps what was allocated in the scope (nothing is rolled back). */
+  void commit() { _mark = (size_t)-1; }
+
+private:
+  BasicViewArena& _arena;
+  size_t _mark;
+};
+
+#endif
@@ -0,0 +1,199 @@
+#ifndef VIEW_LIST_H
+#define VIEW_LIST_H
+
+#include "Views.h"
+
+/** @brief Staging bytes ViewList::writeTo() uses on the stack when no buffer is given. */
+#ifndef VIEWS_LIST_STAGE_BYTES
+#if defined(__AVR__)
+#define VIEWS_LIST_STAGE_BYTES 32
+#else
+#define VIEWS_LIST_STAGE_BYTES 128
+#endif
+#endif
+
+/** @brief One fragment of a ViewList: the same two fields as a POSIX iovec. */
+struct ViewFragment {
+  const uint8_t* data;
+  size_t length;
+};
+
+/**
+ * @class ViewList
+ * @brief Collects up to N text or byte fragments without copying them and
+ * sends them with as few Print::write() calls as possible: a response built
+ * from 15 header tokens, values and separators becomes one UART or TCP write
+ * instead of 15.
+ * @tparam N Maximum number of fragments.
+ *
+ * writeTo() copies fragments shorter than the staging buffer into it and
+ * writes the buffer whenever it fills; a fragment at least as long as the
+ * buffer is written straight from its memory. So a whole list that fits the
+ * buffer goes out in a single write, and large bodies are never copied. For
+ * sockets with scatter/gather I/O, toIovec() fills an iovec array for one
+ * writev() or lwip_writev() call instead.
+ *
+ * The fragments are views: the memory they point to must stay valid until
+ * the list is written.
+ *
+ * @code
+ * ViewList<16> reply;
+ * reply.add("HTTP/1.1 200 OK\r\nContent-Length: ").add(lengthText).add("\r\n\r\n").add(body);
+ * reply.writeTo(client);                     // one write (plus one for a large body)
+ * @endcode
+ */
+template<size_t N>
+class ViewList : public Printable {
+  static_assert(N >= 1, "ViewList needs room for at least one fragment");
+
+public:
+  /** @brief Creates an empty list. */
+  ViewList() : _count(0), _bytes(0), _overflow(false) {}
+
+  // --- Collecting ---
+
+  /** @brief Appends bytes. Empty fragments take no slot; a full list sets overflowed(). */
+  ViewList& add(const uint8_t* data, size_t length) {
+    if (length == 0) return *this;
+    if (_count == N) {
+      _overflow = true;
+      return *this;
+    }
+    _items[_count].data = data;
+    _items[_count].length = length;
+    _count++;
+    _bytes += length;
+    return *this;
+  }
+
+  /** @brief Appends text. */
+  ViewList& add(const MemoryView<char>& text) {
+    return add(reinterpret_cast<const uint8_t*>(text.data()), text.length());
+  }
+
+  /** @brief Appends raw bytes. */
+  ViewList& add(const MemoryView<uint8_t>& data) { return add(data.data(), data.length()); }
+
+  /** @brief Appends a C-string (its terminator excluded). */
+  ViewList& add(const char* text) { return add(StringView(text)); }
+
+  /** @brief Removes every fragment and clears the overflow flag. */
+  void clear() {
+    _count = 0;
+    _bytes = 0;
+    _overflow = false;
+  }
+
+  // --- State ---
+
+  /** @brief Number of fragments. */
+  size_t size() const { return _count; }
+
+  /** @brief Maximum number of fragments. */
+  static constexpr size_t capacity() { return N; }
+
+  /** @brief Total bytes in all fragments. */
+  size_t byteLength() const { return _bytes; }
+
+  /** @brief Returns true if there are no fragments. */
+  bool isEmpty() const { return _count == 0; }
+
+  /** @brief True if a fragment was dropped because the list was full. */
+  bool overflowed() const { return _overflow; }
+
+  /** @brief Fragment i. */
+  MemoryView<uint8_t> operator[](size_t i) const { return MemoryView<uint8_t>(_items[i].data, _items[i].length); }
+
+  /** @brief The fragments as an array of size() entries. */
+  const ViewFragment* fragments() const { return _items; }
+
+  // --- Output ---
+
+  /**
+   * @brief Writes every fragment to out, coalescing small ones in a
+   * VIEWS_LIST_STAGE_BYTES stack buffer.
+   * @return Bytes written; less than byteLength() if out stopped accepting.
+   */
+  size_t writeTo(Print& out) const {
+    uint8_t stage[VIEWS_LIST_STAGE_BYTES];
+    return writeTo(out, stage, sizeof(stage));
+  }
+
+  /**
+   * @brief Writes every fragment to out, coalescing fragments shorter than
+   * capacity in stage (e.g. a static buffer sized to the TCP MSS). With a
+   * null stage every fragment is written separately.
+   */
+  size_t writeTo(Print& out, uint8_t* stage, size_t capacity) const {
+    if (!stage) capacity = 0;
+    size_t written = 0, staged = 0;
+    for (size_t i = 0; i < _count; i++) {
+      const ViewFragment& f = _items[i];
+      if (f.length < capacity) {
+        if (f.length > capacity - staged) {
+          if (!flush(out, stage, staged, written)) return written;
+        }
+        memcpy(stage + staged, f.data, f.length);
+        staged += f.length;
+        continue;
+      }
+      if (!flush(out, stage, staged, written)) return written;
+      size_t n = out.write(f.data, f.length);
+      written += n;
+      if (n < f.length) return written;
+    }
+    flush(out, stage, staged, written);
+    return written;
+  }
+
+  /** @brief Printable interface: print(list) and println(list) coalesce the same way. */
+  size_t printTo(Print& p) const override { return writeTo(p); }
+
+  /**
+   * @brief Gathers the fragments into dst[0, capacity), e.g. to checksum or
+   * queue a frame.
+   * @return Bytes copied (at most capacity).
+   */
+  size_t copyTo(uint8_t* dst, size_t capacity) const {
+    size_t at = 0;
+    for (size_t i = 0; i < _count && at < capacity; i++) {
+      size_t n = _items[i].length < capacity - at ? _items[i].length : capacity - at;
+      memcpy(dst + at, _items[i].data, n);
+      at += n;
+    }
+    return at;
+  }
+
+  /**
+   * @brief Fills iov[0, max) for writev()-style calls. Iov is any struct with
+   * iov_base and iov_len members (struct iovec from <sys/uio.h> or lwIP).
+   * @return Entries filled (all fragments if max >= size()).
+   */
+  template<typename Iov>
+  size_t toIovec(Iov* iov, size_t max) const {
+    size_t n = _count < max ? _count : max;
+    for (size_t i = 0; i < n; i++) {
+      iov[i].iov_base = const_cast<uint8_t*>(_items[i].data);
+      iov[i].iov_len = _items[i].length;
+    }
+    return n;
+  }
+
+private:
+  /** @brief Writes the staged bytes; false if out took fewer than offered. */
+  static bool flush(Print& out, const uint8_t* stage, size_t& staged, size_t& written) {
+    if (staged == 0) return true;
+    size_t n = out.write(stage, staged);
+    written += n;
+    bool all = n == staged;
+    staged = 0;
+    return all;
+  }
+
+  ViewFragment _items[N];
+  size_t _count;
+  size_t _bytes;
+  bool _overflow;
+};
+
+#endif
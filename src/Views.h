@@ -4,6 +4,292 @@
 #include <Arduino.h>
 #include <Printable.h>
 
+/**
+ * @brief Minimum pattern length for which Boyer-Moore-Horspool is used.
+ * Horspool needs a 256-byte skip table; on AVR it is disabled by default to
+ * keep that table off the stack. Set to 0 to disable it everywhere.
+ */
+#ifndef VIEWS_HORSPOOL_MIN_PATTERN
+#if defined(__AVR__)
+#define VIEWS_HORSPOOL_MIN_PATTERN 0
+#else
+#define VIEWS_HORSPOOL_MIN_PATTERN 8
+#endif
+#endif
+
+/** @brief Minimum haystack length before a one-shot indexOf builds a skip table. */
+#ifndef VIEWS_HORSPOOL_MIN_HAYSTACK
+#define VIEWS_HORSPOOL_MIN_HAYSTACK 256
+#endif
+
+/**
+ * @brief Enables word-at-a-time (SWAR) scanning for 1-byte element searches.
+ * Disabled on AVR, where registers are 8 bits wide and avr-libc's hand-written
+ * memchr is already the fastest option.
+ */
+#ifndef VIEWS_USE_SWAR
+#if defined(__AVR__)
+#define VIEWS_USE_SWAR 0
+#else
+#define VIEWS_USE_SWAR 1
+#endif
+#endif
+
+/**
+ * @brief 1 if StringView is a literal type, so "..."_sv and constexpr
+ * StringView constants and tables are available. The ESP8266/ESP32 cores give
+ * Printable a virtual destructor, which rules that out; there the views are
+ * still constant-initialised, just not usable in constant expressions.
+ */
+#ifndef VIEWS_CONSTEXPR_STRINGVIEW
+#if defined(ARDUINO_ARCH_ESP8266) || defined(ARDUINO_ARCH_ESP32) || defined(ESP8266) || defined(ESP32)
+#define VIEWS_CONSTEXPR_STRINGVIEW 0
+#else
+#define VIEWS_CONSTEXPR_STRINGVIEW 1
+#endif
+#endif
+
+#if VIEWS_CONSTEXPR_STRINGVIEW
+#define VIEWS_SV_CONSTEXPR constexpr
+#else
+#define VIEWS_SV_CONSTEXPR inline
+#endif
+
+/**
+ * @brief Placement and access of constant lookup tables.
+ * On AVR and ESP8266 const data would be copied to RAM, so tables go to
+ * program memory (PROGMEM) and are read with the _P functions; elsewhere
+ * const data is already flash-resident and read directly.
+ * VIEWS_FLASH_CMP compares RAM bytes against a table like memcmp;
+ * VIEWS_FLASH_BYTE reads one table byte; VIEWS_FLASH_STRLEN measures a
+ * string in flash.
+ */
+#if defined(__AVR__) || defined(ESP8266) || defined(ARDUINO_ARCH_ESP8266)
+#define VIEWS_FLASH PROGMEM
+#define VIEWS_FLASH_READ(dst, src, n) memcpy_P((dst), (src), (n))
+#define VIEWS_FLASH_CMP(ram, flash, n) memcmp_P((ram), (flash), (n))
+#define VIEWS_FLASH_BYTE(p) pgm_read_byte(p)
+#define VIEWS_FLASH_STRLEN(p) strlen_P(p)
+#else
+#define VIEWS_FLASH
+#define VIEWS_FLASH_READ(dst, src, n) memcpy((dst), (src), (n))
+#define VIEWS_FLASH_CMP(ram, flash, n) memcmp((ram), (flash), (n))
+#define VIEWS_FLASH_BYTE(p) (*(const uint8_t*)(p))
+#define VIEWS_FLASH_STRLEN(p) strlen(p)
+#endif
+
+/** @brief Search algorithms available to MemoryView::indexOf and Searcher. */
+enum class SearchStrategy : uint8_t {
+  Auto,      ///< Pick by pattern length (default).
+  Naive,     ///< Plain double loop.
+  FirstByte, ///< Jump between occurrences of the first element, then verify.
+  Horspool   ///< Boyer-Moore-Horspool bad-character skip (1-byte types only).
+};
+
+namespace view_detail {
+
+/** @brief Sentinel returned by the raw search helpers. */
+const size_t kNotFound = (size_t)-1;
+
+/** @brief True for types that compare bytewise (char, signed/unsigned char). */
+template<typename T> struct IsByteLike { static const bool value = false; };
+template<> struct IsByteLike<char> { static const bool value = true; };
+template<> struct IsByteLike<signed char> { static const bool value = true; };
+template<> struct IsByteLike<unsigned char> { static const bool value = true; };
+
+#if VIEWS_USE_SWAR
+/** @brief Native machine word used for SWAR scanning. */
+#if UINTPTR_MAX > 0xFFFFFFFFu
+typedef uint64_t Word;
+#else
+typedef uint32_t Word;
+#endif
+
+const Word kLowBits = (Word)-1 / 0xFF;  // 0x0101...01
+const Word kHighBits = kLowBits << 7;   // 0x8080...80
+
+/** @brief Non-zero if any byte of w equals the byte broadcast in pattern. */
+inline Word hasByte(Word w, Word pattern) {
+  w ^= pattern;
+  return (w - kLowBits) & ~w & kHighBits;
+}
+
+/** @brief Loads one word from an address that the caller has aligned. */
+inline Word loadWord(const uint8_t* p) {
+  Word w;
+  memcpy(&w, p, sizeof(Word));
+  return w;
+}
+
+inline bool isWordAligned(const uint8_t* p) {
+  return ((uintptr_t)p & (sizeof(Word) - 1)) == 0;
+}
+
+/** @brief Exact mask: 0x80 in every byte of w that equals the broadcast byte. */
+inline Word byteEqualMask(Word w, Word pattern) {
+  w ^= pattern;
+  return ~(((w & ~kHighBits) + ~kHighBits) | w | ~kHighBits);
+}
+
+/** @brief 0x80 in every byte of w that is in [lo, hi] (ASCII bounds only). */
+inline Word byteRangeMask(Word w, uint8_t lo, uint8_t hi) {
+  Word low7 = w & ~kHighBits;
+  Word geLo = low7 + kLowBits * (uint8_t)(0x80 - lo);
+  Word gtHi = low7 + kLowBits * (uint8_t)(0x7F - hi);
+  return (geLo ^ gtHi) & ~w & kHighBits;
+}
+
+/** @brief Sets the 0x20 bit of every ASCII 'A'-'Z' byte of w. */
+inline Word lowerWord(Word w) { return w | (byteRangeMask(w, 'A', 'Z') >> 2); }
+
+/** @brief Clears the 0x20 bit of every ASCII 'a'-'z' byte of w. */
+inline Word upperWord(Word w) { return w & ~(byteRangeMask(w, 'a', 'z') >> 2); }
+#endif
+
+/** @brief First index of v in d[0, n), scanning a word at a time where enabled. */
+inline size_t findByte(const uint8_t* d, size_t n, uint8_t v) {
+#if VIEWS_USE_SWAR
+  size_t i = 0;
+  for (; i < n && !isWordAligned(d + i); i++)
+    if (d[i] == v) return i;
+  const Word pattern = kLowBits * v;
+  for (; i + sizeof(Word) <= n; i += sizeof(Word))
+    if (hasByte(loadWord(d + i), pattern)) break;
+  for (; i < n; i++)
+    if (d[i] == v) return i;
+  return kNotFound;
+#else
+  const void* p = memchr(d, v, n);
+  return p ? (size_t)((const uint8_t*)p - d) : kNotFound;
+#endif
+}
+
+/** @brief Last index of v in d[0, n), scanning a word at a time where enabled. */
+inline size_t findLastByte(const uint8_t* d, size_t n, uint8_t v) {
+#if VIEWS_USE_SWAR
+  size_t i = n;
+  for (; i > 0 && !isWordAligned(d + i); i--)
+    if (d[i - 1] == v) return i - 1;
+  const Word pattern = kLowBits * v;
+  for (; i >= sizeof(Word); i -= sizeof(Word))
+    if (hasByte(loadWord(d + i - sizeof(Word)), pattern)) break;
+#else
+  size_t i = n;
+#endif
+  for (; i > 0; i--)
+    if (d[i - 1] == v) return i - 1;
+  return kNotFound;
+}
+
+/** @brief Element-wise primitives; the byte specialisation scans words. */
+template<typename T, bool Byte = IsByteLike<T>::value>
+struct Ops {
+  static size_t find(const T* d, size_t n, const T& v) {
+    for (size_t i = 0; i < n; i++)
+      if (d[i] == v) return i;
+    return kNotFound;
+  }
+  static size_t findLast(const T* d, size_t n, const T& v) {
+    for (size_t i = n; i > 0; i--)
+      if (d[i - 1] == v) return i - 1;
+    return kNotFound;
+  }
+  static bool equal(const T* a, const T* b, size_t n) {
+    for (size_t i = 0; i < n; i++)
+      if (!(a[i] == b[i])) return false;
+    return true;
+  }
+};
+
+template<typename T>
+struct Ops<T, true> {
+  static size_t find(const T* d, size_t n, const T& v) {
+    return findByte(reinterpret_cast<const uint8_t*>(d), n, (uint8_t)v);
+  }
+  static size_t findLast(const T* d, size_t n, const T& v) {
+    return findLastByte(reinterpret_cast<const uint8_t*>(d), n, (uint8_t)v);
+  }
+  static bool equal(const T* a, const T* b, size_t n) {
+    return memcmp(a, b, n) == 0;
+  }
+};
+
+/** @brief O(n*m) reference search. */
+template<typename T>
+size_t searchNaive(const T* h, size_t n, const T* p, size_t m) {
+  for (size_t i = 0; i + m <= n; i++)
+    if (Ops<T>::equal(h + i, p, m)) return i;
+  return kNotFound;
+}
+
+/** @brief Skip to each occurrence of p[0] (memchr for bytes), then verify the rest. */
+template<typename T>
+size_t searchFirstByte(const T* h, size_t n, const T* p, size_t m) {
+  size_t i = 0;
+  while (i + m <= n) {
+    size_t hit = Ops<T>::find(h + i, n - m + 1 - i, p[0]);
+    if (hit == kNotFound) return kNotFound;
+    i += hit;
+    if (Ops<T>::equal(h + i + 1, p + 1, m - 1)) return i;
+    i++;
+  }
+  return kNotFound;
+}
+
+/** @brief Fills a Horspool bad-character table; shifts are capped at 255. */
+inline void buildSkipTable(const uint8_t* p, size_t m, uint8_t* skip) {
+  memset(skip, m > 255 ? 255 : (int)m, 256);
+  for (size_t i = (m > 256) ? m - 256 : 0; i + 1 < m; i++)
+    skip[p[i]] = (uint8_t)(m - 1 - i);
+}
+
+/** @brief Boyer-Moore-Horspool over a prebuilt skip table. */
+inline size_t searchHorspool(const uint8_t* h, size_t n, const uint8_t* p, size_t m,
+                             const uint8_t* skip) {
+  const uint8_t last = p[m - 1];
+  size_t i = 0;
+  while (i + m <= n) {
+    uint8_t c = h[i + m - 1];
+    if (c == last && memcmp(h + i, p, m - 1) == 0) return i;
+    i += skip[c];
+  }
+  return kNotFound;
+}
+
+/** @brief Resolves SearchStrategy::Auto for a pattern of length m. */
+template<typename T>
+SearchStrategy pickStrategy(size_t m) {
+#if VIEWS_HORSPOOL_MIN_PATTERN > 0
+  if (IsByteLike<T>::value && m >= VIEWS_HORSPOOL_MIN_PATTERN)
+    return SearchStrategy::Horspool;
+#else
+  (void)m;
+#endif
+  return SearchStrategy::FirstByte;
+}
+
+/** @brief One-shot search used by MemoryView::indexOf. */
+template<typename T>
+size_t search(const T* h, size_t n, const T* p, size_t m) {
+  if (m == 1) return Ops<T>::find(h, n, p[0]);
+  if (IsByteLike<T>::value && n >= VIEWS_HORSPOOL_MIN_HAYSTACK &&
+      pickStrategy<T>(m) == SearchStrategy::Horspool) {
+    uint8_t skip[256];
+    buildSkipTable(reinterpret_cast<const uint8_t*>(p), m, skip);
+    return searchHorspool(reinterpret_cast<const uint8_t*>(h), n,
+                          reinterpret_cast<const uint8_t*>(p), m, skip);
+  }
+  return searchFirstByte(h, n, p, m);
+}
+
+/** @brief Default ordering for the binary searches: a < b (mixed types allowed). */
+struct Less {
+  template<typename A, typename B>
+  bool operator()(const A& a, const B& b) const { return a < b; }
+};
+
+} // namespace view_detail
+
 /**
  * @class MemoryView
  * @brief A generic, non-owning window into any contiguous data array.
@@ -13,35 +299,35 @@ template<typename T>
 class MemoryView {
 public:
   /** @brief Default constructor creating an empty view. */
-  MemoryView() : _data(nullptr), _len(0) {}
+  constexpr MemoryView() : _data(nullptr), _len(0) {}
 
   /** @brief Constructs a view from a pointer and a specific length. */
-  MemoryView(const T* data, size_t len) : _data(data), _len(len) {}
+  constexpr MemoryView(const T* data, size_t len) : _data(data), _len(len) {}
 
   /** @brief Constructs a view directly from a fixed-size C-style array. */
   template<size_t N>
-  MemoryView(const T (&arr)[N]) : _data(arr), _len(N) {}
+  constexpr MemoryView(const T (&arr)[N]) : _data(arr), _len(N) {}
 
   /** @brief Gets the underlying pointer. */
-  const T* data() const { return _data; }
+  constexpr const T* data() const { return _data; }
 
   /** @brief Gets the number of elements. */
-  size_t length() const { return _len; }
+  constexpr size_t length() const { return _len; }
 
   /** @brief Checks if the view is empty. */
-  bool isEmpty() const { return _len == 0; }
+  constexpr bool isEmpty() const { return _len == 0; }
 
   /** @brief Accesses an element by index. */
-  const T& operator[](size_t index) const { return _data[index]; }
+  constexpr const T& operator[](size_t index) const { return _data[index]; }
 
   /** @brief Calculates total size in bytes. */
-  size_t sizeBytes() const { return _len * sizeof(T); }
+  constexpr size_t sizeBytes() const { return _len * sizeof(T); }
 
   /** @brief Iterator support (start). */
-  const T* begin() const { return _data; }
+  constexpr const T* begin() const { return _data; }
 
   /** @brief Iterator support (end). */
-  const T* end() const { return _data + _len; }
+  constexpr const T* end() const { return _data + _len; }
 
   /**
    * @brief Creates a sub-view of the current data.
@@ -54,32 +340,90 @@ public:
     return MemoryView<T>(_data + start, (length > avail) ? avail : length);
   }
 
-  /** @brief Finds the first occurrence of a value. */
+  /** @brief Finds the first occurrence of a value (word-at-a-time for 1-byte types). */
   int indexOf(const T& value, size_t from = 0) const {
-    for (size_t i = from; i < _len; i++)
-      if (_data[i] == value) return (int) i;
-    return -1;
+    if (from >= _len) return -1;
+    size_t pos = view_detail::Ops<T>::find(_data + from, _len - from, value);
+    return (pos == view_detail::kNotFound) ? -1 : (int)(pos + from);
+  }
+
+  /**
+   * @brief Finds the last occurrence of a value.
+   * @param from Highest index to consider (defaults to the end of the view).
+   */
+  int lastIndexOf(const T& value, size_t from = (size_t)-1) const {
+    size_t n = (from < _len) ? from + 1 : _len;
+    size_t pos = view_detail::Ops<T>::findLast(_data, n, value);
+    return (pos == view_detail::kNotFound) ? -1 : (int)pos;
   }
 
-  /** @brief Finds the first occurrence of a pattern (sub-view). */
+  /**
+   * @brief Finds the first occurrence of a pattern (sub-view).
+   * Single elements use a direct scan, short patterns skip between
+   * occurrences of their first element and long byte patterns use
+   * Boyer-Moore-Horspool. Use Searcher to reuse the setup for a fixed pattern.
+   */
   int indexOf(const MemoryView<T>& pattern, size_t from = 0) const {
-    if (pattern._len == 0 || pattern._len > (_len - from)) return -1;
-    for (size_t i = from; i <= _len - pattern._len; i++) {
-      bool match = true;
-      for (size_t j = 0; j < pattern._len; j++) {
-        if (_data[i + j] != pattern._data[j]) {
-          match = false;
-          break;
-        }
-      }
-      if (match) return (int) i;
-    }
-    return -1;
+    if (pattern._len == 0 || from > _len || pattern._len > (_len - from)) return -1;
+    size_t pos = view_detail::search(_data + from, _len - from, pattern._data, pattern._len);
+    return (pos == view_detail::kNotFound) ? -1 : (int)(pos + from);
   }
 
   /** @brief Checks if a value exists. */
   bool contains(const T& value) const { return indexOf(value) != -1; }
 
+  // --- Sorted Data ---
+  // The view must be sorted by less. less(element, value) orders an element
+  // before a lookup value; upperBound and equalRange also call
+  // less(value, element), so mixed-type comparators need both overloads.
+
+  /** @brief True if no element is ordered before its predecessor. */
+  template<typename Less = view_detail::Less>
+  bool isSorted(Less less = Less()) const {
+    for (size_t i = 1; i < _len; i++)
+      if (less(_data[i], _data[i - 1])) return false;
+    return true;
+  }
+
+  /**
+   * @brief Index of the first element not ordered before value (length() if
+   * none). The loop halves the range with a conditional move instead of a
+   * branch, so the number of steps depends only on the length.
+   */
+  template<typename V, typename Less = view_detail::Less>
+  size_t lowerBound(const V& value, Less less = Less()) const {
+    if (_len == 0) return 0;
+    const T* base = _data;
+    for (size_t n = _len; n > 1; n -= n / 2)
+      base = less(base[n / 2], value) ? base + n / 2 : base;
+    return (size_t)(base - _data) + (less(*base, value) ? 1 : 0);
+  }
+
+  /** @brief Index of the first element ordered after value (length() if none). */
+  template<typename V, typename Less = view_detail::Less>
+  size_t upperBound(const V& value, Less less = Less()) const {
+    if (_len == 0) return 0;
+    const T* base = _data;
+    for (size_t n = _len; n > 1; n -= n / 2)
+      base = less(value, base[n / 2]) ? base : base + n / 2;
+    return (size_t)(base - _data) + (less(value, *base) ? 0 : 1);
+  }
+
+  /** @brief Index of an element equivalent to value, or -1 (O(log n) indexOf for sorted data). */
+  template<typename V, typename Less = view_detail::Less>
+  int binarySearch(const V& value, Less less = Less()) const {
+    size_t i = lowerBound(value, less);
+    return (i < _len && !less(value, _data[i])) ? (int)i : -1;
+  }
+
+  /** @brief The sub-view of all elements equivalent to value (empty if none). */
+  template<typename V, typename Less = view_detail::Less>
+  MemoryView<T> equalRange(const V& value, Less less = Less()) const {
+    size_t lo = lowerBound(value, less);
+    MemoryView<T> rest(_data + lo, _len - lo);
+    return MemoryView<T>(_data + lo, rest.upperBound(value, less));
+  }
+
   /** @brief Reinterprets data as a different type. */
   template<typename U>
   MemoryView<U> castTo() const {
@@ -91,6 +435,617 @@ protected:
   size_t _len;
 };
 
+/**
+ * @class Searcher
+ * @brief Precomputed search for a fixed pattern, reusable across many haystacks.
+ * @tparam T The type of the data elements.
+ *
+ * The pattern is not copied; it must outlive the searcher. For 1-byte types
+ * the Horspool strategy stores a 256-byte skip table inside the object.
+ */
+template<typename T, bool Byte = view_detail::IsByteLike<T>::value>
+class Searcher {
+public:
+  /** @brief Prepares a search for pattern (Horspool falls back to FirstByte). */
+  explicit Searcher(const MemoryView<T>& pattern, SearchStrategy strategy = SearchStrategy::Auto)
+    : _pattern(pattern),
+      _strategy(strategy == SearchStrategy::Naive ? strategy : SearchStrategy::FirstByte) {}
+
+  /** @brief Finds the first occurrence of the pattern in haystack at or after from. */
+  int find(const MemoryView<T>& haystack, size_t from = 0) const {
+    size_t m = _pattern.length();
+    if (m == 0 || from > haystack.length() || m > haystack.length() - from) return -1;
+    const T* h = haystack.data() + from;
+    size_t n = haystack.length() - from;
+    size_t pos = (_strategy == SearchStrategy::Naive)
+      ? view_detail::searchNaive(h, n, _pattern.data(), m)
+      : view_detail::searchFirstByte(h, n, _pattern.data(), m);
+    return (pos == view_detail::kNotFound) ? -1 : (int)(pos + from);
+  }
+
+  /** @brief The pattern being searched for. */
+  const MemoryView<T>& pattern() const { return _pattern; }
+
+  /** @brief The strategy actually in use. */
+  SearchStrategy strategy() const { return _strategy; }
+
+private:
+  MemoryView<T> _pattern;
+  SearchStrategy _strategy;
+};
+
+/** @brief Searcher specialisation for 1-byte types with a Horspool skip table. */
+template<typename T>
+class Searcher<T, true> {
+public:
+  /** @brief Prepares a search for pattern, building the skip table if needed. */
+  explicit Searcher(const MemoryView<T>& pattern, SearchStrategy strategy = SearchStrategy::Auto)
+    : _pattern(pattern), _strategy(strategy) {
+    if (_strategy == SearchStrategy::Auto)
+      _strategy = view_detail::pickStrategy<T>(pattern.length());
+    if (_strategy == SearchStrategy::Horspool && pattern.length() < 2)
+      _strategy = SearchStrategy::FirstByte;
+    if (_strategy == SearchStrategy::Horspool)
+      view_detail::buildSkipTable(bytes(pattern.data()), pattern.length(), _skip);
+  }
+
+  /** @brief Finds the first occurrence of the pattern in haystack at or after from. */
+  int find(const MemoryView<T>& haystack, size_t from = 0) const {
+    size_t m = _pattern.length();
+    if (m == 0 || from > haystack.length() || m > haystack.length() - from) return -1;
+    const T* h = haystack.data() + from;
+    size_t n = haystack.length() - from;
+    size_t pos;
+    switch (_strategy) {
+      case SearchStrategy::Naive:
+        pos = view_detail::searchNaive(h, n, _pattern.data(), m);
+        break;
+      case SearchStrategy::Horspool:
+        pos = view_detail::searchHorspool(bytes(h), n, bytes(_pattern.data()), m, _skip);
+        break;
+      default:
+        pos = view_detail::searchFirstByte(h, n, _pattern.data(), m);
+        break;
+    }
+    return (pos == view_detail::kNotFound) ? -1 : (int)(pos + from);
+  }
+
+  /** @brief The pattern being searched for. */
+  const MemoryView<T>& pattern() const { return _pattern; }
+
+  /** @brief The strategy actually in use. */
+  SearchStrategy strategy() const { return _strategy; }
+
+private:
+  static const uint8_t* bytes(const T* p) { return reinterpret_cast<const uint8_t*>(p); }
+
+  MemoryView<T> _pattern;
+  SearchStrategy _strategy;
+  uint8_t _skip[256];
+};
+
+/**
+ * @class DelimiterSet
+ * @brief A 256-bit membership table of delimiter characters.
+ *
+ * Build one per delimiter set and reuse it; each lookup is a single bit test
+ * instead of a chain of character comparisons.
+ */
+class DelimiterSet {
+public:
+  /** @brief Creates an empty set. */
+  DelimiterSet() { memset(_bits, 0, sizeof(_bits)); }
+
+  /** @brief Creates a set from the characters of a C-string (e.g. ",; \t"). */
+  DelimiterSet(const char* chars) {
+    memset(_bits, 0, sizeof(_bits));
+    if (chars)
+      while (*chars) add(*chars++);
+  }
+
+  /** @brief Creates a set from every character of a view. */
+  explicit DelimiterSet(const MemoryView<char>& chars) {
+    memset(_bits, 0, sizeof(_bits));
+    for (size_t i = 0; i < chars.length(); i++) add(chars[i]);
+  }
+
+  /** @brief Adds a character to the set. */
+  DelimiterSet& add(char c) {
+    uint8_t b = (uint8_t)c;
+    _bits[b >> 3] |= (uint8_t)(1 << (b & 7));
+    return *this;
+  }
+
+  /** @brief Checks if a character is in the set. */
+  bool contains(char c) const {
+    uint8_t b = (uint8_t)c;
+    return (_bits[b >> 3] >> (b & 7)) & 1;
+  }
+
+  /** @brief Index of the first member in d[from, n), or n if none. */
+  size_t scan(const char* d, size_t n, size_t from) const {
+    while (from < n && !contains(d[from])) from++;
+    return from;
+  }
+
+private:
+  uint8_t _bits[32];
+};
+
+/** @brief Outcome of an in-place numeric parse. */
+enum class ParseStatus : uint8_t {
+  Ok,       ///< A number was read.
+  NoDigits, ///< The view does not start with a number.
+  Overflow  ///< The number does not fit; value is clamped.
+};
+
+/**
+ * @brief Value, consumed character count and status of a numeric parse.
+ * Parsing stops at the first character that cannot extend the number, so
+ * consumed may be less than the view length.
+ */
+template<typename T>
+struct ParseResult {
+  T value;
+  size_t consumed;
+  ParseStatus status;
+
+  /** @brief True if a number was read without overflow. */
+  bool ok() const { return status == ParseStatus::Ok; }
+};
+
+namespace view_detail {
+
+/**
+ * @brief Fill and copy loops for element arrays. The trivially copyable form
+ * uses memcpy/memmove; selecting it by template argument keeps those calls
+ * from being instantiated for types with their own copy assignment.
+ */
+template<typename T, bool Trivial = __is_trivially_copyable(T)>
+struct CopyOps {
+  static void fill(T* d, size_t n, const T& value) {
+    for (size_t i = 0; i < n; i++) d[i] = value;
+  }
+  static void copy(T* d, const T* s, size_t n) {
+    for (size_t i = 0; i < n; i++) d[i] = s[i];
+  }
+  /** @brief copy() that allows overlap. */
+  static void move(T* d, const T* s, size_t n) {
+    if (d <= s) {
+      copy(d, s, n);
+    } else {
+      for (size_t i = n; i > 0; i--) d[i - 1] = s[i - 1];
+    }
+  }
+};
+
+template<typename T>
+struct CopyOps<T, true> {
+  /** @brief Doubling memcpy: log2(n) calls instead of n assignments. */
+  static void fill(T* d, size_t n, const T& value) {
+    if (n == 0) return;
+    d[0] = value;
+    for (size_t done = 1; done < n; done *= 2)
+      memcpy(d + done, d, ((n - done < done) ? n - done : done) * sizeof(T));
+  }
+  static void copy(T* d, const T* s, size_t n) {
+    if (n) memcpy(d, s, n * sizeof(T));
+  }
+  static void move(T* d, const T* s, size_t n) {
+    if (n) memmove(d, s, n * sizeof(T));
+  }
+};
+
+template<typename T> struct MakeUnsigned { typedef T type; };
+template<> struct MakeUnsigned<char> { typedef unsigned char type; };
+template<> struct MakeUnsigned<signed char> { typedef unsigned char type; };
+template<> struct MakeUnsigned<short> { typedef unsigned short type; };
+template<> struct MakeUnsigned<int> { typedef unsigned int type; };
+template<> struct MakeUnsigned<long> { typedef unsigned long type; };
+template<> struct MakeUnsigned<long long> { typedef unsigned long long type; };
+
+template<bool C, typename A, typename B> struct Conditional { typedef A type; };
+template<typename A, typename B> struct Conditional<false, A, B> { typedef B type; };
+
+template<bool B, typename T = void> struct EnableIf {};
+template<typename T> struct EnableIf<true, T> { typedef T type; };
+
+template<typename P> struct IsCharPointer { static const bool value = false; };
+template<> struct IsCharPointer<const char*> { static const bool value = true; };
+template<> struct IsCharPointer<char*> { static const bool value = true; };
+
+/**
+ * @brief Index of the first NUL in s[lo, hi), or hi. Halves the range, so the
+ * recursion is only log2(hi - lo) deep, and reads bytes in order, never past
+ * the first NUL.
+ */
+constexpr size_t cstrnlenIn(const char* s, size_t lo, size_t hi);
+
+constexpr size_t cstrnlenRight(const char* s, size_t left, size_t mid, size_t hi) {
+  return left < mid ? left : cstrnlenIn(s, mid, hi);
+}
+
+constexpr size_t cstrnlenIn(const char* s, size_t lo, size_t hi) {
+  return hi - lo <= 1 ? ((lo < hi && s[lo] == '\0') ? lo : hi)
+                      : cstrnlenRight(s, cstrnlenIn(s, lo, lo + (hi - lo) / 2), lo + (hi - lo) / 2, hi);
+}
+
+/** @brief strnlen over memory known to hold n readable bytes. */
+inline size_t memNulLength(const char* s, size_t n) {
+  const void* nul = memchr(s, '\0', n);
+  return nul ? (size_t)(static_cast<const char*>(nul) - s) : n;
+}
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define VIEWS_HAS_CONSTANT_EVALUATED 1
+#endif
+#endif
+
+/**
+ * @brief strnlen usable in constant expressions. At run time (where the
+ * compiler can tell) it calls memchr instead of recursing.
+ */
+constexpr size_t cstrnlen(const char* s, size_t n) {
+#ifdef VIEWS_HAS_CONSTANT_EVALUATED
+  return __builtin_is_constant_evaluated() ? cstrnlenIn(s, 0, n) : memNulLength(s, n);
+#else
+  return cstrnlenIn(s, 0, n);
+#endif
+}
+
+inline bool isDigit(char c) { return (uint8_t)(c - '0') < 10; }
+
+/** @brief Value of a hex digit, or -1. */
+inline int hexValue(char c) {
+  if (isDigit(c)) return c - '0';
+  uint8_t l = (uint8_t)(c | 0x20) - 'a';
+  return (l < 6) ? l + 10 : -1;
+}
+
+/**
+ * @brief ASCII lower-case of c by table lookup (bytes >= 0x80 unchanged), so
+ * case-insensitive loops have no locale call and no branch per character.
+ */
+inline uint8_t foldCase(uint8_t c) {
+  static const uint8_t table[256] VIEWS_FLASH = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F,
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F,
+    0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF,
+    0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+    0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF,
+    0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF,
+    0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF,
+    0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF
+  };
+  return VIEWS_FLASH_BYTE(table + c);
+}
+
+/**
+ * @brief memcmp-style ordering of a[0, n) and b[0, n) after ASCII lower-casing.
+ * Whole words are folded with the 0x20-bit trick (lowerWord) and compared at
+ * once; only the word that differs is re-examined byte by byte.
+ */
+inline int compareFolded(const char* a, const char* b, size_t n) {
+  const uint8_t* x = reinterpret_cast<const uint8_t*>(a);
+  const uint8_t* y = reinterpret_cast<const uint8_t*>(b);
+  size_t i = 0;
+#if VIEWS_USE_SWAR
+  for (; i + sizeof(Word) <= n; i += sizeof(Word)) {
+    Word wx = loadWord(x + i), wy = loadWord(y + i);
+    if (wx != wy && lowerWord(wx) != lowerWord(wy)) break;
+  }
+#endif
+  for (; i < n; i++) {
+    int d = (int)foldCase(x[i]) - (int)foldCase(y[i]);
+    if (d) return d;
+  }
+  return 0;
+}
+
+/** @brief Case-insensitive (ASCII) equality of a[0, n) and b[0, n). */
+inline bool equalFolded(const char* a, const char* b, size_t n) {
+  return compareFolded(a, b, n) == 0;
+}
+
+/** @brief First index in d[0, n) holding either byte u or v; word-at-a-time where enabled. */
+inline size_t findEitherByte(const uint8_t* d, size_t n, uint8_t u, uint8_t v) {
+  if (u == v) return findByte(d, n, u);
+  size_t i = 0;
+#if VIEWS_USE_SWAR
+  for (; i < n && !isWordAligned(d + i); i++)
+    if (d[i] == u || d[i] == v) return i;
+  const Word pu = kLowBits * u, pv = kLowBits * v;
+  for (; i + sizeof(Word) <= n; i += sizeof(Word)) {
+    Word w = loadWord(d + i);
+    if (hasByte(w, pu) | hasByte(w, pv)) break;
+  }
+#endif
+  for (; i < n; i++)
+    if (d[i] == u || d[i] == v) return i;
+  return kNotFound;
+}
+
+/** @brief Case-insensitive search: jump to either case of p[0], then verify folded. */
+inline size_t searchFolded(const char* h, size_t n, const char* p, size_t m) {
+  const uint8_t* d = reinterpret_cast<const uint8_t*>(h);
+  uint8_t lower = foldCase((uint8_t)p[0]);
+  uint8_t upper = (uint8_t)(lower - 'a') < 26 ? (uint8_t)(lower & ~0x20) : lower;
+  for (size_t i = 0; i + m <= n; i++) {
+    size_t hit = findEitherByte(d + i, n - m + 1 - i, lower, upper);
+    if (hit == kNotFound) return kNotFound;
+    i += hit;
+    if (compareFolded(h + i + 1, p + 1, m - 1) == 0) return i;
+  }
+  return kNotFound;
+}
+
+/**
+ * @brief Accumulates decimal digits from d[0, n) into out, saturating at limit.
+ * @return Number of digits consumed (all leading digits, even after overflow).
+ */
+template<typename U>
+size_t readDigits(const char* d, size_t n, U limit, U& out, bool& overflow) {
+  U v = 0;
+  size_t i = 0;
+  overflow = false;
+  for (; i < n && isDigit(d[i]); i++) {
+    U digit = (U)(d[i] - '0');
+    if (overflow || v > (U)((limit - digit) / 10)) {
+      overflow = true;
+      v = limit;
+    } else {
+      v = (U)(v * 10 + digit);
+    }
+  }
+  out = v;
+  return i;
+}
+
+/** @brief Reads one element of a VIEWS_FLASH table. */
+template<typename T>
+T flashRead(const T* p) {
+  T v;
+  VIEWS_FLASH_READ(&v, p, sizeof(T));
+  return v;
+}
+
+template<size_t... I> struct IndexSeq {};
+
+template<typename A, typename B> struct ConcatSeq;
+template<size_t... A, size_t... B>
+struct ConcatSeq<IndexSeq<A...>, IndexSeq<B...> > {
+  typedef IndexSeq<A..., (sizeof...(A) + B)...> type;
+};
+
+/** @brief IndexSeq<0, ..., N - 1>, built with logarithmic instantiation depth. */
+template<size_t N> struct MakeIndexSeq {
+  typedef typename ConcatSeq<typename MakeIndexSeq<N / 2>::type,
+                             typename MakeIndexSeq<N - N / 2>::type>::type type;
+};
+template<> struct MakeIndexSeq<0> { typedef IndexSeq<> type; };
+template<> struct MakeIndexSeq<1> { typedef IndexSeq<0> type; };
+
+/** @brief Brace-initialised array that constant expressions can index. */
+template<typename T, size_t N> struct ConstArray { T v[N]; };
+
+// Largest and smallest of a[lo, hi), split in halves to keep the recursion
+// depth logarithmic.
+
+template<typename T, size_t N>
+constexpr T maxOf(const ConstArray<T, N>& a, size_t lo, size_t hi) {
+  return (hi - lo == 1) ? a.v[lo]
+       : (maxOf(a, lo, lo + (hi - lo) / 2) > maxOf(a, lo + (hi - lo) / 2, hi))
+         ? maxOf(a, lo, lo + (hi - lo) / 2) : maxOf(a, lo + (hi - lo) / 2, hi);
+}
+
+template<typename T, size_t N>
+constexpr T minOf(const ConstArray<T, N>& a, size_t lo, size_t hi) {
+  return (hi - lo == 1) ? a.v[lo]
+       : (minOf(a, lo, lo + (hi - lo) / 2) < minOf(a, lo + (hi - lo) / 2, hi))
+         ? minOf(a, lo, lo + (hi - lo) / 2) : minOf(a, lo + (hi - lo) / 2, hi);
+}
+
+/**
+ * @brief A VIEWS_FLASH array whose element i is Gen::at(i), filled in by the
+ * compiler. No code runs to build it.
+ */
+template<typename T, typename Gen, typename Seq> struct FlashTable;
+template<typename T, typename Gen, size_t... I>
+struct FlashTable<T, Gen, IndexSeq<I...> > {
+  static const T* data() {
+    static const T table[] VIEWS_FLASH = { Gen::at(I)... };
+    return table;
+  }
+};
+
+/** @brief 10^e for e in [0, 9]. */
+inline uint32_t pow10u32(uint8_t e) {
+  static const uint32_t table[] VIEWS_FLASH = {
+    1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL,
+    1000000UL, 10000000UL, 100000000UL, 1000000000UL
+  };
+  return flashRead(&table[e]);
+}
+
+/**
+ * @brief Limits of exact float arithmetic: integers up to maxMantissa and
+ * powers of ten up to 10^maxExactPow10 are exactly representable.
+ */
+template<typename F> struct FloatTraits;
+template<> struct FloatTraits<float> {
+  static const uint8_t maxExactPow10 = 10;
+  static const uint32_t maxMantissa = 1UL << 24;
+};
+template<> struct FloatTraits<double> {
+  static const uint8_t maxExactPow10 = (sizeof(double) > 4) ? 22 : 10;
+  static const uint64_t maxMantissa = (sizeof(double) > 4) ? (1ULL << 53) : (1ULL << 24);
+};
+
+/** @brief Exact 10^e for e in [0, FloatTraits<F>::maxExactPow10]. */
+template<typename F>
+F exactPow10(uint8_t e) {
+  static const F table[] VIEWS_FLASH = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+  return flashRead(&table[e]);
+}
+
+/** @brief A decimal number split into an integer mantissa and a power of ten. */
+template<typename M>
+struct DecimalParts {
+  M mantissa;
+  int exp10;
+  size_t consumed;
+  bool negative;
+  uint8_t firstDropped; ///< Value of the first digit that did not fit (0 if none), for rounding.
+};
+
+/**
+ * @brief Scans [+-]ddd[.ddd][e[+-]dd] from d[0, n) without converting it.
+ * Digits that no longer fit in M are dropped (integer digits raise exp10).
+ * @return False if there is no digit in the mantissa.
+ */
+template<typename M>
+bool scanDecimal(const char* d, size_t n, DecimalParts<M>& out) {
+  const M fitLimit = (M)(((M)-1 - 9) / 10);
+  size_t i = 0;
+  out.negative = false;
+  if (n > 0 && (d[0] == '-' || d[0] == '+')) {
+    out.negative = d[0] == '-';
+    i = 1;
+  }
+  M mant = 0;
+  int exp10 = 0;
+  bool any = false, inFrac = false, dropped = false;
+  out.firstDropped = 0;
+  for (; i < n; i++) {
+    char c = d[i];
+    if (c == '.' && !inFrac) {
+      inFrac = true;
+      continue;
+    }
+    if (!isDigit(c)) break;
+    any = true;
+    if (mant <= fitLimit) {
+      mant = (M)(mant * 10 + (M)(c - '0'));
+      if (inFrac) exp10--;
+      continue;
+    }
+    if (!dropped) out.firstDropped = (uint8_t)(c - '0');
+    dropped = true;
+    if (!inFrac) exp10++;
+  }
+  if (!any) return false;
+  if (i + 1 < n && (d[i] | 0x20) == 'e') {
+    size_t j = i + 1;
+    bool expNeg = false;
+    if (d[j] == '-' || d[j] == '+') expNeg = d[j++] == '-';
+    unsigned int e;
+    bool expOverflow;
+    size_t digits = readDigits<unsigned int>(d + j, n - j, 9999, e, expOverflow);
+    if (digits) {
+      exp10 += expNeg ? -(int)e : (int)e;
+      i = j + digits;
+    }
+  }
+  out.mantissa = mant;
+  out.exp10 = exp10;
+  out.consumed = i;
+  return true;
+}
+
+/**
+ * @brief Builds mantissa * 10^exp10 from the exact power table.
+ * Small mantissas and exponents take Clinger's fast path (one exactly
+ * rounded multiply or divide); float mantissas too long for it go through
+ * double where double is wider. Everything else chains table steps, trading
+ * the last ulp or so for a few kilobytes less code than strtod.
+ */
+template<typename F, typename M>
+F composeFloat(M mant, int exp10) {
+  const uint8_t step = FloatTraits<F>::maxExactPow10;
+  if (sizeof(F) < sizeof(double) && mant > FloatTraits<F>::maxMantissa &&
+      exp10 >= -FloatTraits<double>::maxExactPow10 && exp10 <= FloatTraits<double>::maxExactPow10)
+    return (F)composeFloat<double>(mant, exp10);
+  F value = (F)mant;
+  if (mant == 0) return value;
+  if (exp10 >= 0 && exp10 <= step && mant <= FloatTraits<F>::maxMantissa)
+    return value * exactPow10<F>((uint8_t)exp10);
+  if (exp10 < 0 && -exp10 <= step && mant <= FloatTraits<F>::maxMantissa)
+    return value / exactPow10<F>((uint8_t)-exp10);
+  for (; exp10 > step; exp10 -= step)
+    if (isinf(value *= exactPow10<F>(step))) return value;
+  for (; exp10 < -step; exp10 += step)
+    if ((value /= exactPow10<F>(step)) == 0) return value;
+  return (exp10 >= 0) ? value * exactPow10<F>((uint8_t)exp10)
+                      : value / exactPow10<F>((uint8_t)-exp10);
+}
+
+/** @brief 32-bit load of p[0, 4) with p[0] least significant (one load on little-endian parts). */
+inline uint32_t loadLE32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+inline uint32_t rotl32(uint32_t x, uint8_t r) { return (x << r) | (x >> (32 - r)); }
+
+constexpr uint32_t kXxhPrime1 = 2654435761UL;
+constexpr uint32_t kXxhPrime2 = 2246822519UL;
+constexpr uint32_t kXxhPrime3 = 3266489917UL;
+constexpr uint32_t kXxhPrime4 = 668265263UL;
+constexpr uint32_t kXxhPrime5 = 374761393UL;
+
+/** @brief One xxHash32 lane step over a 4-byte input. */
+inline uint32_t xxh32Round(uint32_t acc, uint32_t input) {
+  return rotl32(acc + input * kXxhPrime2, 13) * kXxhPrime1;
+}
+
+/** @brief Consumes the last n (< 16) bytes into h and applies the final avalanche. */
+inline uint32_t xxh32Finish(uint32_t h, const uint8_t* p, size_t n) {
+  for (; n >= 4; n -= 4, p += 4) h = rotl32(h + loadLE32(p) * kXxhPrime3, 17) * kXxhPrime4;
+  for (; n > 0; n--, p++) h = rotl32(h + *p * kXxhPrime5, 11) * kXxhPrime1;
+  h ^= h >> 15;
+  h *= kXxhPrime2;
+  h ^= h >> 13;
+  h *= kXxhPrime3;
+  h ^= h >> 16;
+  return h;
+}
+
+/** @brief xxHash32 of p[0, n) in one call. */
+inline uint32_t xxh32(const uint8_t* p, size_t n, uint32_t seed) {
+  size_t total = n;
+  uint32_t h;
+  if (n >= 16) {
+    uint32_t v1 = seed + kXxhPrime1 + kXxhPrime2, v2 = seed + kXxhPrime2;
+    uint32_t v3 = seed, v4 = seed - kXxhPrime1;
+    for (; n >= 16; n -= 16, p += 16) {
+      v1 = xxh32Round(v1, loadLE32(p));
+      v2 = xxh32Round(v2, loadLE32(p + 4));
+      v3 = xxh32Round(v3, loadLE32(p + 8));
+      v4 = xxh32Round(v4, loadLE32(p + 12));
+    }
+    h = rotl32(v1, 1) + rotl32(v2, 7) + rotl32(v3, 12) + rotl32(v4, 18);
+  } else {
+    h = seed + kXxhPrime5;
+  }
+  return xxh32Finish(h + (uint32_t)total, p, n);
+}
+
+} // namespace view_detail
+
+class SplitRange;
+class FlashStringView;
+
 /**
  * @class StringView
  * @brief Specialized MemoryView for zero-copy string manipulation and parsing.
@@ -101,16 +1056,31 @@ public:
 
   /** @brief Expose base class search methods to avoid shadowing. */
   using MemoryView<char>::indexOf;
+  using MemoryView<char>::lastIndexOf;
   using MemoryView<char>::contains;
 
   /** @brief Promote MemoryView<char> to StringView. */
-  StringView(const MemoryView<char>& base)
+  constexpr StringView(const MemoryView<char>& base)
     : MemoryView<char>(base.data(), base.length()) {}
 
-  /** @brief Construct from C-string literal. */
-  StringView(const char* str)
+  /**
+   * @brief Construct from a string literal or char array.
+   * The length is the text up to the first NUL (at most N), which the
+   * compiler evaluates at build time for literals, so no strlen runs.
+   */
+  template<size_t N>
+  constexpr StringView(const char (&str)[N])
+    : MemoryView<char>(str, view_detail::cstrnlen(str, N)) {}
+
+  /** @brief Construct from a C-string pointer (uses strlen). */
+  template<typename P,
+           typename view_detail::EnableIf<view_detail::IsCharPointer<P>::value, int>::type = 0>
+  StringView(P str)
     : MemoryView<char>(str, str ? strlen(str) : 0) {}
 
+  /** @brief Construct an empty view from nullptr. */
+  constexpr StringView(decltype(nullptr)) : MemoryView<char>() {}
+
   /** @brief Construct from Arduino String (points to internal buffer). */
   StringView(const String& s)
     : MemoryView<char>(s.c_str(), s.length()) {}
@@ -137,28 +1107,169 @@ public:
     return indexOf(StringView(s)) != -1;
   }
 
+  /** @brief Finds the pattern of a precomputed Searcher. */
+  int indexOf(const Searcher<char>& searcher, size_t from = 0) const {
+    return searcher.find(*this, from);
+  }
+
+  /** @brief Checks if the pattern of a precomputed Searcher exists within this view. */
+  bool contains(const Searcher<char>& searcher) const {
+    return searcher.find(*this) != -1;
+  }
+
+  // --- Flash Operands (defined in FlashStringView.h, included below) ---
+
+  /** @brief Finds a pattern stored in flash. */
+  int indexOf(const FlashStringView& pattern, size_t from = 0) const;
+
+  /** @brief Checks if a pattern stored in flash exists within this view. */
+  bool contains(const FlashStringView& pattern) const;
+  bool contains(const __FlashStringHelper* pattern) const;
+
+  /** @brief Content equality with text stored in flash. */
+  bool equals(const FlashStringView& other) const;
+
+  /** @brief Prefix check against text stored in flash. */
+  bool startsWith(const FlashStringView& prefix) const;
+
   // --- Numeric Conversions ---
 
-  /** @brief Parses view as a long integer. */
+  /**
+   * @brief Parses a signed decimal integer ([+-]digits) in place.
+   * @tparam T Signed integer type of the result.
+   */
+  template<typename T = long>
+  ParseResult<T> parseInt() const {
+    typedef typename view_detail::MakeUnsigned<T>::type U;
+    const U maxValue = (U)(((U)-1) >> 1);
+    size_t i = 0;
+    bool neg = false;
+    if (_len > 0 && (_data[0] == '-' || _data[0] == '+')) {
+      neg = _data[0] == '-';
+      i = 1;
+    }
+    U mag;
+    bool overflow;
+    size_t digits = view_detail::readDigits<U>(_data + i, _len - i,
+                                               neg ? (U)(maxValue + 1) : maxValue, mag, overflow);
+    if (digits == 0) return ParseResult<T>{0, 0, ParseStatus::NoDigits};
+    T value = neg ? (mag ? (T)(-(T)(mag - 1) - 1) : 0) : (T)mag;
+    return ParseResult<T>{value, i + digits, overflow ? ParseStatus::Overflow : ParseStatus::Ok};
+  }
+
+  /**
+   * @brief Parses an unsigned decimal integer ([+]digits) in place.
+   * @tparam T Unsigned integer type of the result.
+   */
+  template<typename T = unsigned long>
+  ParseResult<T> parseUnsigned() const {
+    size_t i = (_len > 0 && _data[0] == '+') ? 1 : 0;
+    T value;
+    bool overflow;
+    size_t digits = view_detail::readDigits<T>(_data + i, _len - i, (T)-1, value, overflow);
+    if (digits == 0) return ParseResult<T>{0, 0, ParseStatus::NoDigits};
+    return ParseResult<T>{value, i + digits, overflow ? ParseStatus::Overflow : ParseStatus::Ok};
+  }
+
+  /**
+   * @brief Parses hexadecimal digits with an optional 0x/0X prefix in place.
+   * @tparam T Unsigned integer type of the result.
+   */
+  template<typename T = uint32_t>
+  ParseResult<T> parseHex() const {
+    size_t i = 0;
+    if (_len > 2 && _data[0] == '0' && (_data[1] | 0x20) == 'x' &&
+        view_detail::hexValue(_data[2]) >= 0)
+      i = 2;
+    size_t start = i;
+    T value = 0;
+    bool overflow = false;
+    for (int h; i < _len && (h = view_detail::hexValue(_data[i])) >= 0; i++) {
+      if (value > (T)(((T)-1) >> 4)) overflow = true;
+      value = (T)((value << 4) | (T)h);
+    }
+    if (i == start) return ParseResult<T>{0, 0, ParseStatus::NoDigits};
+    if (overflow) value = (T)-1;
+    return ParseResult<T>{value, i, overflow ? ParseStatus::Overflow : ParseStatus::Ok};
+  }
+
+  /**
+   * @brief Parses [+-]ddd[.ddd][e[+-]dd] as an integer scaled by 10^decimals,
+   * using integer arithmetic only. "21.5" with decimals = 3 gives 21500.
+   * @param decimals Number of decimal places kept (0-9).
+   * @param round Round half away from zero instead of truncating extra digits.
+   */
+  ParseResult<int32_t> parseFixedPoint(uint8_t decimals, bool round = false) const {
+    view_detail::DecimalParts<uint32_t> parts;
+    if (!view_detail::scanDecimal(_data, _len, parts))
+      return ParseResult<int32_t>{0, 0, ParseStatus::NoDigits};
+    const uint32_t limit = parts.negative ? 0x80000000UL : 0x7FFFFFFFUL;
+    uint32_t v = parts.mantissa;
+    bool overflow = false;
+    int shift = parts.exp10 + decimals;
+    for (; shift > 0 && v != 0; shift--) {
+      if (v > limit / 10) {
+        overflow = true;
+        break;
+      }
+      v *= 10;
+    }
+    if (shift < -9) {
+      v = 0;
+    } else if (shift < 0) {
+      uint32_t div = view_detail::pow10u32((uint8_t)-shift);
+      uint32_t rem = v % div;
+      v /= div;
+      if (round && rem >= div - rem) v++;
+    } else if (shift == 0 && round && parts.firstDropped >= 5) {
+      v++;   // the digits scanDecimal could not keep were the ones below the last place
+    }
+    if (overflow || v > limit) {
+      overflow = true;
+      v = limit;
+    }
+    int32_t value = parts.negative ? (v ? -(int32_t)(v - 1) - 1 : 0) : (int32_t)v;
+    return ParseResult<int32_t>{value, parts.consumed,
+                                overflow ? ParseStatus::Overflow : ParseStatus::Ok};
+  }
+
+  /** @brief Fixed-point shorthand: the scaled, rounded value, or 0 on error. */
+  int32_t toFixed(uint8_t decimals) const {
+    ParseResult<int32_t> r = skipLeadingSpace().parseFixedPoint(decimals, true);
+    return (r.status == ParseStatus::NoDigits) ? 0 : r.value;
+  }
+
+  /**
+   * @brief Parses [+-]ddd[.ddd][e[+-]dd] in place without strtod.
+   * The digits are gathered into an integer mantissa and scaled by a table of
+   * exact powers of ten; common sensor values are rounded exactly.
+   * @tparam F float or double.
+   */
+  template<typename F = float>
+  ParseResult<F> parseFloat() const {
+    typedef typename view_detail::Conditional<(sizeof(F) > 4), uint64_t, uint32_t>::type M;
+    view_detail::DecimalParts<M> parts;
+    if (!view_detail::scanDecimal(_data, _len, parts))
+      return ParseResult<F>{0, 0, ParseStatus::NoDigits};
+    F value = view_detail::composeFloat<F>(parts.mantissa, parts.exp10);
+    if (parts.negative) value = -value;
+    return ParseResult<F>{value, parts.consumed,
+                          isinf(value) ? ParseStatus::Overflow : ParseStatus::Ok};
+  }
+
+  /** @brief Parses view as a long integer, skipping leading whitespace (clamps on overflow). */
   long toLong() const {
-    char buf[_len + 1];
-    memcpy(buf, _data, _len);
-    buf[_len] = '\0';
-    return atol(buf);
+    return skipLeadingSpace().parseInt<long>().value;
   }
 
   /** @brief Parses view as a float. */
   float toFloat() const {
-    return (float)toDouble();
+    return skipLeadingSpace().parseFloat<float>().value;
   }
 
-  /** @brief Parses view as a double using strtod for precision. */
+  /** @brief Parses view as a double. */
   double toDouble() const {
-    char buf[32];
-    size_t copyLen = (_len > 31) ? 31 : _len;
-    memcpy(buf, _data, copyLen);
-    buf[copyLen] = '\0';
-    return strtod(buf, nullptr);
+    return skipLeadingSpace().parseFloat<double>().value;
   }
 
   // --- Utilities & Operators ---
@@ -171,8 +1282,19 @@ public:
 
   bool operator==(const StringView& other) const { return equals(other); }
 
+  /**
+   * @brief Equality check with a string literal or char array: the text up
+   * to its first NUL (at most N), as the array constructor takes it.
+   */
+  template<size_t N>
+  bool operator==(const char (&s)[N]) const {
+    return _len == view_detail::cstrnlen(s, N) && (_len == 0 || memcmp(_data, s, _len) == 0);
+  }
+
   /** @brief Equality check with C-string. */
-  bool operator==(const char* s) const {
+  template<typename P,
+           typename view_detail::EnableIf<view_detail::IsCharPointer<P>::value, int>::type = 0>
+  bool operator==(P s) const {
     if (!s) return _len == 0;
     size_t sLen = strlen(s);
     if (_len != sLen) return false;
@@ -186,7 +1308,15 @@ public:
   }
 
   /** @brief Global operator for ("literal" == stringView). */
-  friend bool operator==(const char* lhs, const StringView& rhs) {
+  template<size_t N>
+  friend bool operator==(const char (&lhs)[N], const StringView& rhs) {
+    return rhs == lhs;
+  }
+
+  /** @brief Global operator for (pointer == stringView). */
+  template<typename P,
+           typename view_detail::EnableIf<view_detail::IsCharPointer<P>::value, int>::type = 0>
+  friend bool operator==(P lhs, const StringView& rhs) {
     return rhs == lhs;
   }
 
@@ -196,6 +1326,75 @@ public:
     return memcmp(_data, prefix._data, prefix._len) == 0;
   }
 
+  /** @brief Content equality ignoring ASCII case ("Content-Length" == "content-length"). */
+  bool equalsIgnoreCase(const StringView& other) const {
+    return _len == other._len && view_detail::equalFolded(_data, other._data, _len);
+  }
+
+  /** @brief Prefix check ignoring ASCII case. */
+  bool startsWithIgnoreCase(const StringView& prefix) const {
+    return prefix._len <= _len && view_detail::equalFolded(_data, prefix._data, prefix._len);
+  }
+
+  /** @brief Suffix check. */
+  bool endsWith(const StringView& suffix) const {
+    return suffix._len <= _len && memcmp(_data + _len - suffix._len, suffix._data, suffix._len) == 0;
+  }
+
+  /** @brief Suffix check ignoring ASCII case. */
+  bool endsWithIgnoreCase(const StringView& suffix) const {
+    return suffix._len <= _len &&
+           view_detail::equalFolded(_data + _len - suffix._len, suffix._data, suffix._len);
+  }
+
+  /**
+   * @brief Lexicographic byte order, like strcmp: negative if this view sorts
+   * before other, 0 if equal, positive after. A prefix sorts first.
+   */
+  int compare(const StringView& other) const {
+    size_t n = (_len < other._len) ? _len : other._len;
+    int d = n ? memcmp(_data, other._data, n) : 0;
+    if (d) return d;
+    return (_len < other._len) ? -1 : (_len > other._len) ? 1 : 0;
+  }
+
+  /** @brief compare() on ASCII lower-cased text (so "B" sorts after "a"). */
+  int compareIgnoreCase(const StringView& other) const {
+    size_t n = (_len < other._len) ? _len : other._len;
+    int d = view_detail::compareFolded(_data, other._data, n);
+    if (d) return d;
+    return (_len < other._len) ? -1 : (_len > other._len) ? 1 : 0;
+  }
+
+  /** @brief Ordering for sorting and binary search (compare() < 0). */
+  bool operator<(const StringView& other) const { return compare(other) < 0; }
+
+  /** @brief Finds pattern ignoring ASCII case; -1 if not found. */
+  int indexOfIgnoreCase(const StringView& pattern, size_t from = 0) const {
+    if (pattern._len == 0 || from > _len || pattern._len > (_len - from)) return -1;
+    size_t pos = view_detail::searchFolded(_data + from, _len - from, pattern._data, pattern._len);
+    return (pos == view_detail::kNotFound) ? -1 : (int)(pos + from);
+  }
+
+  /** @brief Checks if pattern occurs, ignoring ASCII case. */
+  bool containsIgnoreCase(const StringView& pattern) const { return indexOfIgnoreCase(pattern) != -1; }
+
+  /**
+   * @brief xxHash32 of the characters: fast and well mixed, but not
+   * cryptographic. For hash tables and change detection; XxHash32
+   * (Checksum.h) gives the same value for text fed in pieces.
+   */
+  uint32_t hash(uint32_t seed = 0) const {
+    return view_detail::xxh32(reinterpret_cast<const uint8_t*>(_data), _len, seed);
+  }
+
+  /** @brief Returns a new view with leading whitespace removed. */
+  StringView skipLeadingSpace() const {
+    size_t s = 0;
+    while (s < _len && isspace(_data[s])) s++;
+    return StringView(_data + s, _len - s);
+  }
+
   /** @brief Returns a new view with whitespace removed from ends. */
   StringView trim() const {
     size_t s = 0, e = _len;
@@ -232,6 +1431,48 @@ public:
     return token;
   }
 
+  /** @brief Tokenize by a precomputed Searcher pattern. Updates offset for next call. */
+  StringView nextToken(const Searcher<char>& delim, size_t& offset) const {
+    if (offset >= _len) return StringView();
+    int pos = delim.find(*this, offset);
+    if (pos == -1) {
+      StringView token = StringView(slice(offset));
+      offset = _len;
+      return token;
+    }
+    StringView token = StringView(slice(offset, pos - offset));
+    offset = pos + delim.pattern().length();
+    return token;
+  }
+
+  /** @brief Finds the first character that is a member of delims. */
+  int indexOfAny(const DelimiterSet& delims, size_t from = 0) const {
+    size_t pos = delims.scan(_data, _len, from);
+    return (pos >= _len) ? -1 : (int)pos;
+  }
+
+  /** @brief Tokenize by any member of a delimiter set. Updates offset for next call. */
+  StringView nextToken(const DelimiterSet& delims, size_t& offset) const {
+    if (offset >= _len) return StringView();
+    size_t pos = delims.scan(_data, _len, offset);
+    StringView token = StringView(slice(offset, pos - offset));
+    offset = (pos < _len) ? pos + 1 : _len;
+    return token;
+  }
+
+  /**
+   * @brief Lazily splits the view into tokens for use in range-for loops.
+   * @param delim Delimiter character.
+   * @param skipEmpty Drop empty tokens between adjacent delimiters.
+   * @param maxSplits Stop splitting after this many delimiters; the rest of
+   *                  the view becomes the final token.
+   */
+  SplitRange split(char delim, bool skipEmpty = false, size_t maxSplits = (size_t)-1) const;
+
+  /** @brief Lazily splits the view on any member of a delimiter set. */
+  SplitRange split(const DelimiterSet& delims, bool skipEmpty = false,
+                   size_t maxSplits = (size_t)-1) const;
+
   /** @brief Create a copy as an Arduino String. */
   String toString() const {
     if (_len == 0 || !_data) return String("");
@@ -247,4 +1488,118 @@ public:
   }
 };
 
+/**
+ * @brief String view literal: "GET"_sv. The length comes from the compiler,
+ * so keyword constants and tables never call strlen.
+ */
+VIEWS_SV_CONSTEXPR StringView operator"" _sv(const char* str, size_t len) {
+  return StringView(str, len);
+}
+
+/**
+ * @class SplitRange
+ * @brief Forward-iterable range of StringView tokens returned by StringView::split().
+ *
+ * Tokens are produced on demand; nothing is copied. An empty source yields
+ * no tokens, and a trailing delimiter yields a final empty token unless
+ * empty tokens are skipped. Iterators refer to the range and are only valid
+ * while it is alive.
+ */
+class SplitRange {
+public:
+  /** @brief Splits source on a single character. */
+  SplitRange(const StringView& source, char delim, bool skipEmpty, size_t maxSplits)
+    : _source(source), _delim(delim), _useSet(false),
+      _skipEmpty(skipEmpty), _maxSplits(maxSplits) {}
+
+  /** @brief Splits source on any member of delims (the set is copied). */
+  SplitRange(const StringView& source, const DelimiterSet& delims, bool skipEmpty,
+             size_t maxSplits)
+    : _source(source), _delims(delims), _delim(0), _useSet(true),
+      _skipEmpty(skipEmpty), _maxSplits(maxSplits) {}
+
+  /** @brief Forward iterator over the tokens. */
+  class iterator {
+  public:
+    const StringView& operator*() const { return _token; }
+    const StringView* operator->() const { return &_token; }
+
+    iterator& operator++() {
+      advance();
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator prev = *this;
+      advance();
+      return prev;
+    }
+
+    bool operator==(const iterator& other) const {
+      if (_done || other._done) return _done == other._done;
+      return _token.data() == other._token.data();
+    }
+
+    bool operator!=(const iterator& other) const { return !(*this == other); }
+
+  private:
+    friend class SplitRange;
+
+    iterator(const SplitRange* range, bool done)
+      : _range(range), _next(0), _splits(0), _done(done) {
+      if (!_done) advance();
+    }
+
+    void advance() {
+      const StringView& src = _range->_source;
+      while (_next <= src.length()) {
+        size_t start = _next;
+        size_t end = (_splits < _range->_maxSplits) ? _range->findDelim(start) : src.length();
+        _next = end + 1;
+        if (end == start && _range->_skipEmpty) continue;
+        if (end < src.length()) _splits++;
+        _token = StringView(src.data() + start, end - start);
+        return;
+      }
+      _done = true;
+      _token = StringView();
+    }
+
+    const SplitRange* _range;
+    StringView _token;
+    size_t _next;
+    size_t _splits;
+    bool _done;
+  };
+
+  iterator begin() const { return iterator(this, _source.isEmpty()); }
+  iterator end() const { return iterator(this, true); }
+
+private:
+  size_t findDelim(size_t from) const {
+    if (_useSet) return _delims.scan(_source.data(), _source.length(), from);
+    int pos = _source.indexOf(_delim, from);
+    return (pos == -1) ? _source.length() : (size_t)pos;
+  }
+
+  StringView _source;
+  DelimiterSet _delims;
+  char _delim;
+  bool _useSet;
+  bool _skipEmpty;
+  size_t _maxSplits;
+};
+
+inline SplitRange StringView::split(char delim, bool skipEmpty, size_t maxSplits) const {
+  return SplitRange(*this, delim, skipEmpty, maxSplits);
+}
+
+inline SplitRange StringView::split(const DelimiterSet& delims, bool skipEmpty,
+                                    size_t maxSplits) const {
+  return SplitRange(*this, delims, skipEmpty, maxSplits);
+}
+
+// The StringView members with flash operands are defined with FlashStringView.
+#include "FlashStringView.h"
+
 #endif
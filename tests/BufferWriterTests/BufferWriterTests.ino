@@ -0,0 +1,58 @@
+#include <AUnit.h>
+#include "BufferWriter.h"
+
+test(BufferWriter, appendViewsAndNumbers) {
+  char buf[48];
+  BufferWriter w(buf);
+  StringView topic = "sensors/temp";
+  w.append(topic).append('=').appendInt(-40).append(',').appendInt(4000000000UL);
+  assertTrue(w.view().equals("sensors/temp=-40,4000000000"));
+  assertEqual(strcmp(w.c_str(), "sensors/temp=-40,4000000000"), 0);
+  assertFalse(w.overflowed());
+
+  w.clear();
+  w.appendInt(0).append(' ').appendInt((int8_t)-128).append(' ').appendInt(-9223372036854775807LL - 1);
+  assertTrue(w.view().equals("0 -128 -9223372036854775808"));
+}
+
+test(BufferWriter, hexFixedAndFloat) {
+  StaticBufferWriter<64> w;
+  uint8_t mac[] = {0xDE, 0xAD, 0x0B};
+  w.appendHex(0x1F, 4).append(' ').appendHex(0xABCu, 1, false).append(' ');
+  w.appendHex(MemoryView<uint8_t>(mac));
+  assertTrue(w.view().equals("001F abc DEAD0B"));
+
+  w.clear();
+  w.appendFixed(21500, 3).append(' ').appendFixed(-5, 2).append(' ').appendFixed(7, 0);
+  assertTrue(w.view().equals("21.500 -0.05 7"));
+
+  w.clear();
+  w.appendFloat(3.14159, 3).append(' ').appendFloat(-0.5, 1).append(' ').appendFloat(2.0, 0);
+  assertTrue(w.view().equals("3.142 -0.5 2"));
+}
+
+test(BufferWriter, overflowTracking) {
+  char buf[8];
+  BufferWriter w(buf);
+  assertEqual((int)w.capacity(), 7);
+  w.append("abcd").appendInt(12345);
+  assertTrue(w.overflowed());
+  assertTrue(w.view().equals("abcd"));
+  w.append("efghij");
+  assertTrue(w.view().equals("abcdefg"));
+  assertEqual((int)w.remaining(), 0);
+
+  w.clear();
+  assertFalse(w.overflowed());
+  w.print(StringView("ok"));
+  assertTrue(w.view().equals("ok"));
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
@@ -0,0 +1,61 @@
+#include <AUnit.h>
+#include "ByteReader.h"
+
+test(ByteReader, mixedEndianFrame) {
+  // Modbus-style: address, function, big-endian register, then a little-endian float.
+  uint8_t frame[] = {0x11, 0x03, 0x12, 0x34, 0x00, 0x00, 0x20, 0x41, 0xFE, 0xFF};
+  ByteReader r(frame, sizeof(frame));
+  assertEqual(r.u8(), (uint8_t)0x11);
+  assertEqual(r.u8(), (uint8_t)0x03);
+  assertEqual(r.u16be(), (uint16_t)0x1234);
+  assertNear(r.f32le(), 10.0f, 0.0001f);
+  assertEqual(r.i16le(), (int16_t)-2);
+  assertEqual((int)r.remaining(), 0);
+  assertTrue(r.ok());
+
+  assertEqual(r.peek<uint32_t>(0, Endian::Big), (uint32_t)0x11031234UL);
+  assertEqual(r.peek<uint16_t>(1), (uint16_t)0x1203);
+}
+
+test(ByteReader, unalignedAndBounds) {
+  uint8_t raw[] = {0x00, 0x78, 0x56, 0x34, 0x12, 0xAA};
+  ByteReader r(raw, sizeof(raw));
+  r.skip(1);
+  assertEqual(r.u32le(), (uint32_t)0x12345678UL);
+  assertEqual(r.u16le(), (uint16_t)0);  // only one byte left
+  assertFalse(r.ok());
+  assertEqual((int)r.position(), 5);
+  assertEqual(r.u8(), (uint8_t)0xAA);
+
+  ByteReader s(raw, sizeof(raw));
+  MemoryView<uint8_t> head = s.bytes(2);
+  assertEqual((int)head.length(), 2);
+  assertEqual(head[1], (uint8_t)0x78);
+  s.seek(10);
+  assertFalse(s.ok());
+}
+
+test(ByteReader, readArray) {
+  uint8_t pcm[] = {0x01, 0x00, 0xFF, 0xFF, 0x00, 0x80, 0x10};
+  int16_t samples[3];
+  ByteReader le(pcm, sizeof(pcm));
+  assertEqual((int)le.readArray(samples, 3), 3);
+  assertEqual(samples[0], (int16_t)1);
+  assertEqual(samples[1], (int16_t)-1);
+  assertEqual(samples[2], (int16_t)-32768);
+  assertEqual((int)le.readArray(samples, 1), 0);
+
+  ByteReader be(pcm, sizeof(pcm));
+  assertEqual((int)be.readArray(samples, 2, Endian::Big), 2);
+  assertEqual(samples[0], (int16_t)0x0100);
+  assertEqual(samples[1], (int16_t)-1);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
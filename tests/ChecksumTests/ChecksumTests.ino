@@ -0,0 +1,64 @@
+#include <AUnit.h>
+#include "Checksum.h"
+
+test(Checksum, catalogueCheckValues) {
+  StringView check("123456789");
+  assertEqual(Crc8::compute(check), (uint8_t)0xF4);
+  assertEqual(Crc8Maxim::compute(check), (uint8_t)0xA1);
+  assertEqual(Crc16Ccitt::compute(check), (uint16_t)0x29B1);
+  assertEqual(Crc16Modbus::compute(check), (uint16_t)0x4B37);
+  assertEqual(Crc32::compute(check), (uint32_t)0xCBF43926UL);
+  assertEqual(Crc32C::compute(check), (uint32_t)0xE3069283UL);
+  assertEqual(Crc32::compute(StringView()), (uint32_t)0);
+
+  // A Modbus RTU frame ends with its CRC, low byte first.
+  static const uint8_t frame[] = {0x01, 0x03, 0x00, 0x00, 0x00, 0x0A, 0xC5, 0xCD};
+  MemoryView<uint8_t> f(frame);
+  uint16_t fcs = Crc16Modbus::compute(f.slice(0, 6));
+  assertEqual(fcs, (uint16_t)(frame[6] | (frame[7] << 8)));
+}
+
+test(Checksum, incrementalMatchesOneShot) {
+  static uint8_t data[101];
+  for (size_t i = 0; i < sizeof(data); i++) data[i] = (uint8_t)(i * 37 + 11);
+  MemoryView<uint8_t> all(data);
+  uint32_t crc = Crc32::compute(all);
+  uint16_t ccitt = Crc16Ccitt::compute(all);
+  uint32_t xxh = StringView(reinterpret_cast<const char*>(data), sizeof(data)).hash(7);
+  for (size_t cut = 0; cut <= sizeof(data); cut += 3) {
+    Crc32 c;
+    c.update(all.slice(0, cut)).update(all.slice(cut));
+    assertEqual(c.value(), crc);
+    Crc16Ccitt c16;
+    for (size_t i = 0; i < sizeof(data); i++) c16.update(data[i]);
+    assertEqual(c16.value(), ccitt);
+    XxHash32 h(7);
+    h.update(all.slice(0, cut)).update(all.slice(cut, 5)).update(all.slice(cut + 5));
+    assertEqual(h.value(), xxh);
+  }
+
+  // A wrapped ring region hashes like the same bytes laid out flat.
+  static const uint8_t ring[] = {'6', '7', '8', '9', 'x', 'x', '1', '2', '3', '4', '5'};
+  RingView<uint8_t> r(ring, sizeof(ring), 6, 9);
+  assertEqual(Crc32().update(r).value(), (uint32_t)0xCBF43926UL);
+  assertEqual(XxHash32().update(r).value(), StringView("123456789").hash());
+}
+
+test(Checksum, stringViewHash) {
+  assertEqual(StringView("").hash(), (uint32_t)0x02CC5D05UL);
+  assertEqual(StringView("a").hash(), (uint32_t)0x550D7456UL);
+  assertEqual(StringView("abc").hash(), (uint32_t)0x32D153FFUL);
+  StringView line("GET /index.html HTTP/1.1");
+  assertEqual(StringView(line.slice(4, 11)).hash(), StringView("/index.html").hash());
+  assertTrue(StringView("/index.html").hash() != StringView("/index.htm").hash());
+  assertTrue(StringView("abc").hash() != StringView("abc").hash(1));
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
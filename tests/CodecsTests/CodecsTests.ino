@@ -0,0 +1,142 @@
+#include <AUnit.h>
+#include "Codecs.h"
+
+test(Codecs, hexAndBase64) {
+  static const uint8_t bytes[] = {0xDE, 0xAD, 0xBE, 0xEF, 0x01};
+  char text[16];
+  CodecResult r = Hex::encode(MemoryView<uint8_t>(bytes), MutableView<char>(text));
+  assertTrue(r.ok());
+  assertEqual(r.written, Hex::encodedLength(5));
+  assertTrue(StringView(text, r.written) == "deadbeef01");
+
+  uint8_t out[8];
+  r = Hex::decode("DEadBE", MutableView<uint8_t>(out));
+  assertTrue(r.ok());
+  assertEqual(r.written, (size_t)3);
+  assertEqual(out[2], (uint8_t)0xBE);
+  r = Hex::decode("abc", MutableView<uint8_t>(out));
+  assertTrue(r.status == CodecStatus::Incomplete);
+  assertEqual(r.consumed, (size_t)2);
+  assertTrue(Hex::decode("a?", MutableView<uint8_t>(out)).status == CodecStatus::Invalid);
+
+  // RFC 4648 test vectors, padded and URL-safe.
+  static const char* const vectors[] = {"", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=", "Zm9vYmFy"};
+  static const uint8_t foobar[] = {'f', 'o', 'o', 'b', 'a', 'r'};
+  for (size_t n = 0; n <= 6; n++) {
+    MemoryView<uint8_t> in(foobar, n);
+    r = Base64::encode(in, MutableView<char>(text));
+    assertTrue(r.ok());
+    assertEqual(r.written, Base64::encodedLength(n));
+    assertTrue(StringView(text, r.written) == vectors[n]);
+    assertEqual(Base64::decodedLength(vectors[n]), n);
+    r = Base64::decode(vectors[n], MutableView<uint8_t>(out));
+    assertTrue(r.ok());
+    assertEqual(r.written, n);
+    assertEqual(memcmp(out, foobar, n), 0);
+    r = Base64::encode(in, MutableView<char>(text), true);
+    assertEqual(r.written, Base64::encodedLength(n, true));
+    r = Base64::decode(StringView(text, r.written), MutableView<uint8_t>(out));  // unpadded
+    assertTrue(r.ok());
+    assertEqual(r.written, n);
+  }
+  static const uint8_t high[] = {0xFB, 0xFF, 0xBF};
+  r = Base64::encode(MemoryView<uint8_t>(high), MutableView<char>(text), true);
+  assertTrue(StringView(text, r.written) == "-_-_");
+  assertTrue(Base64::decode("Zm9v!mFy", MutableView<uint8_t>(out)).status == CodecStatus::Invalid);
+  r = Base64::decode("Zm9vYm", MutableView<uint8_t>(out), false);  // streaming: wait for more
+  assertTrue(r.status == CodecStatus::Incomplete);
+  assertEqual(r.consumed, (size_t)4);
+  r = Base64::decode("Zm9vYmFy", MutableView<uint8_t>(out, 4));
+  assertTrue(r.status == CodecStatus::NoRoom);
+  assertEqual(r.written, (size_t)3);
+
+  char inPlace[] = "aGVsbG8gd29ybGQ=";
+  r = Base64::decodeInPlace(MutableStringView(inPlace, strlen(inPlace)));
+  assertTrue(r.ok());
+  assertTrue(StringView(inPlace, r.written) == "hello world");
+}
+
+test(Codecs, urlPercentEncoding) {
+  char buf[48];
+  StringView raw("a b&c=d/é~");
+  CodecResult r = Url::encode(raw, MutableView<char>(buf));
+  assertTrue(r.ok());
+  assertEqual(r.written, Url::encodedLength(raw));
+  assertTrue(StringView(buf, r.written) == "a%20b%26c%3Dd%2F%C3%A9~");
+  r = Url::encode(raw, MutableView<char>(buf), true);
+  assertTrue(StringView(buf, r.written) == "a+b%26c%3Dd%2F%C3%A9~");
+
+  StringView encoded("a+b%26c%3Dd%2F%C3%A9~");
+  r = Url::decode(encoded, MutableView<char>(buf));
+  assertTrue(r.ok());
+  assertEqual(r.written, Url::decodedLength("a%20b%26c%3Dd%2F%C3%A9~"));
+  assertTrue(StringView(buf, r.written) == raw);
+  r = Url::decode("a+b", MutableView<char>(buf), false);
+  assertTrue(StringView(buf, r.written) == "a+b");
+
+  r = Url::decode("50%2", MutableView<char>(buf));
+  assertTrue(r.status == CodecStatus::Incomplete);
+  assertEqual(r.consumed, (size_t)2);
+  assertTrue(StringView(buf, r.written) == "50");
+  assertTrue(Url::decode("50%zz", MutableView<char>(buf)).status == CodecStatus::Invalid);
+  r = Url::decode("abcdef", MutableView<char>(buf, 4));
+  assertTrue(r.status == CodecStatus::NoRoom);
+  assertEqual(r.consumed, (size_t)4);
+
+  char query[] = "name=J%C3%BCrgen+M";
+  r = Url::decodeInPlace(MutableStringView(query, strlen(query)));
+  assertTrue(StringView(query, r.written) == "name=Jürgen M");
+}
+
+test(Codecs, jsonStrings) {
+  char buf[32];
+  StringView raw("say \"hi\"\n\t\\ \x01 \xC3\xA9");
+  CodecResult r = JsonString::escape(raw, MutableView<char>(buf));
+  assertTrue(r.ok());
+  assertEqual(r.written, JsonString::escapedLength(raw));
+  assertTrue(StringView(buf, r.written) == "say \\\"hi\\\"\\n\\t\\\\ \\u0001 \xC3\xA9");
+
+  StringView escaped(buf, r.written);
+  char back[32];
+  r = JsonString::unescape(escaped, MutableView<char>(back));
+  assertTrue(r.ok());
+  assertEqual(r.written, JsonString::unescapedLength(escaped));
+  assertTrue(StringView(back, r.written) == raw);
+
+  // \u escapes become UTF-8, surrogate pairs one 4-byte sequence.
+  char text[] = "\\u00e9\\u20AC\\ud83d\\ude00!";
+  assertEqual(JsonString::unescapedLength(text), (size_t)(2 + 3 + 4 + 1));
+  r = JsonString::unescapeInPlace(MutableStringView(text, strlen(text)));
+  assertTrue(r.ok());
+  assertTrue(StringView(text, r.written) == "\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80!");
+
+  assertTrue(JsonString::unescape("bad \\x", MutableView<char>(back)).status == CodecStatus::Invalid);
+  r = JsonString::unescape("cut \\u00", MutableView<char>(back));
+  assertTrue(r.status == CodecStatus::Incomplete);
+  assertEqual(r.consumed, (size_t)4);
+  // Surrogates: a pair split across chunks waits for the rest, unpaired ones become U+FFFD.
+  r = JsonString::unescape("pair \\ud83d\\ud", MutableView<char>(back));
+  assertTrue(r.status == CodecStatus::Incomplete);
+  assertEqual(r.consumed, (size_t)5);
+  r = JsonString::unescape("\\ud83d\\ude00", MutableView<char>(back));
+  assertTrue(StringView(back, r.written) == "\xF0\x9F\x98\x80");
+  r = JsonString::unescape("\\uD800", MutableView<char>(back), true);
+  assertTrue(r.ok());
+  assertTrue(StringView(back, r.written) == "\xEF\xBF\xBD");
+  r = JsonString::unescape("\\uD800x\\uDC00", MutableView<char>(back));
+  assertTrue(r.ok());
+  assertTrue(StringView(back, r.written) == "\xEF\xBF\xBDx\xEF\xBF\xBD");
+  assertEqual(JsonString::unescapedLength("\\uD800"), (size_t)3);
+  r = JsonString::unescape("abc\\n", MutableView<char>(back, 3));
+  assertTrue(r.status == CodecStatus::NoRoom);
+  assertEqual(r.written, (size_t)3);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
@@ -0,0 +1,67 @@
+#include <AUnit.h>
+#include "FieldIndex.h"
+
+test(FieldIndex, randomAccess) {
+  FieldIndex<8> csv(StringView("2024-05-01,12:00,,21.5,ok"));
+  assertEqual((int)csv.count(), 5);
+  assertTrue(csv.field(0) == "2024-05-01");
+  assertTrue(csv.field(2).isEmpty());
+  assertEqual(csv[3].toFixed(1), 215L);
+  assertTrue(csv.field(4) == "ok");
+  assertTrue(csv.field(5).isEmpty());
+  assertFalse(csv.isTruncated());
+
+  FieldIndex<1> one;
+  assertEqual((int)one.split(StringView("")), 1);
+  assertTrue(one.field(0).isEmpty());
+
+  // Extra fields stay in the last one.
+  FieldIndex<3> few;
+  assertEqual((int)few.split(StringView("a;b;c;d;e"), ';'), 3);
+  assertTrue(few.field(2) == "c;d;e");
+  assertTrue(few.isTruncated());
+}
+
+test(FieldIndex, wordScanMatchesTokenizer) {
+  char line[100];
+  for (size_t i = 0; i < sizeof(line); i++) line[i] = (i * 7 % 5 == 0) ? ',' : (char)('a' + i % 26);
+  for (size_t len = 1; len < sizeof(line); len += 3) {
+    StringView text(line, len);
+    FieldIndex<64> fields(text);
+    size_t offset = 0;
+    for (size_t i = 0; i < fields.count(); i++) {
+      StringView token = text.nextToken(',', offset);
+      assertEqual((int)fields.field(i).length(), (int)token.length());
+      if (!token.isEmpty()) assertTrue(fields.field(i) == token);
+    }
+    int commas = 0;
+    for (int at = text.indexOf(','); at != -1; at = text.indexOf(',', at + 1)) commas++;
+    assertEqual((int)fields.count(), commas + 1);
+  }
+}
+
+test(FieldIndex, nmeaChecksum) {
+  FieldIndex<20> gga;
+  assertTrue(gga.parseNmea(
+    StringView("$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47\r\n")));
+  assertEqual((int)gga.count(), 15);
+  assertTrue(gga.field(0) == "GPGGA");
+  assertEqual(gga.field(7).toLong(), 8L);
+  assertTrue(gga.field(13).isEmpty());
+  assertTrue(gga.field(14).isEmpty());
+
+  assertFalse(gga.parseNmea(StringView("$GPGGA,123519,4807.038,N*48")));
+  assertTrue(gga.hasChecksum());
+  assertFalse(gga.parseNmea(StringView("$GPGGA,123519")));
+  assertFalse(gga.hasChecksum());
+  assertTrue(gga.field(1) == "123519");
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
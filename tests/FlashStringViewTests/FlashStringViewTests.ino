@@ -0,0 +1,59 @@
+#include <AUnit.h>
+#include "FlashStringView.h"
+#include "BufferWriter.h"
+
+const char kTopic[] PROGMEM = "gateway/sensors/temperature";
+
+test(FlashStringView, compareWithRam) {
+  FlashStringView topic(kTopic);
+  assertEqual((int)topic.length(), 27);
+  assertEqual(topic[8], 's');
+
+  char rx[] = "gateway/sensors/temperature";
+  StringView ram(rx);
+  assertTrue(topic == ram);
+  assertTrue(ram == topic);
+  assertTrue(ram.equals(topic));
+  assertTrue(topic.startsWith("gateway/"));
+  assertTrue(ram.startsWith(topic.slice(0, 15)));
+  assertFalse(topic == StringView("gateway/sensors"));
+
+  assertTrue(StringView("OK") == F("OK"));
+  assertFalse(StringView("OK") == F("OK2"));
+  assertTrue(VIEWS_F("ERROR") == StringView("ERROR"));
+  assertTrue(topic.slice(8, 7).equals(VIEWS_F("sensors")));
+}
+
+test(FlashStringView, searchBothWays) {
+  StringView line("+CMGL: 1,\"REC UNREAD\",\"+15551234\"");
+  assertEqual(line.indexOf(VIEWS_F("UNREAD")), 14);
+  assertEqual(line.indexOf(VIEWS_F("UNREAD"), 15), -1);
+  assertTrue(line.contains(F("+1555")));
+  assertFalse(line.contains(F("READ,")));
+
+  FlashStringView topic(kTopic);
+  assertEqual(topic.indexOf('/'), 7);
+  assertEqual(topic.indexOf('/', 8), 15);
+  assertEqual(topic.indexOf(StringView("temp")), 16);
+  assertEqual(topic.indexOf(StringView("tempx")), -1);
+}
+
+test(FlashStringView, printWithoutCopy) {
+  StaticBufferWriter<40> out;
+  FlashStringView topic(kTopic);
+  out.print(topic);
+  assertTrue(out.view() == topic);
+
+  char head[7];
+  assertEqual((int)topic.copyTo(head, sizeof(head)), 7);
+  assertTrue(StringView(head, 7) == "gateway");
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
@@ -0,0 +1,85 @@
+#include <AUnit.h>
+#include "FrameScanner.h"
+
+test(FrameScanner, linesAcrossFragments) {
+  uint8_t buf[32];
+  FrameScanner s(buf, Framing::Delimited);
+  assertTrue(s.setDelimiter("\r\n"));
+  assertFalse(s.setDelimiter(""));                   // rejected: "\r\n" stays
+  assertFalse(s.setDelimiter("--boundary"));         // longer than VIEWS_FRAME_MAX_DELIMITER
+  StringView line;
+
+  // The delimiter itself is split between reads.
+  s.feed("+CREG: 0,1\r");
+  assertFalse(s.next(line));
+  s.feed("\nOK\r\n+CSQ");
+  assertTrue(s.next(line));
+  assertTrue(line == "+CREG: 0,1");
+  assertTrue(s.next(line));
+  assertTrue(line == "OK");
+  assertFalse(s.next(line));
+  assertEqual((int)s.buffered(), 4);
+
+  s.feed(": 21,0\r");
+  s.feed("\r\r\n");  // partial match restarts correctly
+  assertTrue(s.next(line));
+  assertTrue(line == "+CSQ: 21,0\r\r");
+  assertFalse(s.overflowed());
+}
+
+test(FrameScanner, overflowResynchronises) {
+  uint8_t buf[8];
+  FrameScanner s(buf);  // "\n" lines
+  StringView line;
+  s.feed("0123456789");  // does not fit: only 8 bytes accepted
+  assertFalse(s.next(line));
+  s.feed("AB\nok\n");
+  assertTrue(s.overflowed());
+  assertTrue(s.next(line));  // the oversized line is dropped up to its '\n'
+  assertTrue(line == "ok");
+}
+
+test(FrameScanner, lengthSlipAndCobs) {
+  uint8_t buf[32];
+  MemoryView<uint8_t> frame;
+
+  FrameScanner len(buf, Framing::LengthPrefixed);
+  len.setLengthPrefix(2, Endian::Big);
+  uint8_t lp[] = {0x00, 0x03, 'a', 'b', 'c', 0x00, 0x01};
+  len.feed(MemoryView<uint8_t>(lp, 4));
+  assertFalse(len.next(frame));
+  len.feed(MemoryView<uint8_t>(lp + 4, 3));
+  assertTrue(len.next(frame));
+  assertEqual((int)frame.length(), 3);
+  assertEqual(frame[2], (uint8_t)'c');
+  assertFalse(len.next(frame));
+
+  uint8_t slipBuf[32];
+  FrameScanner slip(slipBuf, Framing::Slip);
+  uint8_t sl[] = {0xC0, 0x01, 0xDB, 0xDC, 0x02, 0xDB, 0xDD, 0xC0, 0x05, 0xDB, 0x00, 0xC0};
+  slip.feed(MemoryView<uint8_t>(sl));
+  assertTrue(slip.next(frame));
+  uint8_t slipOut[] = {0x01, 0xC0, 0x02, 0xDB};
+  assertTrue(frame.length() == 4 && memcmp(frame.data(), slipOut, 4) == 0);
+  assertFalse(slip.next(frame));  // bad escape is dropped
+  assertEqual((int)slip.errors(), 1);
+
+  uint8_t cobsBuf[32];
+  FrameScanner cobs(cobsBuf, Framing::Cobs);
+  uint8_t cb[] = {0x03, 0x11, 0x22, 0x02, 0x33, 0x00};  // 11 22 00 33
+  cobs.feed(MemoryView<uint8_t>(cb, 2));
+  assertFalse(cobs.next(frame));
+  cobs.feed(MemoryView<uint8_t>(cb + 2, 4));
+  assertTrue(cobs.next(frame));
+  uint8_t cobsOut[] = {0x11, 0x22, 0x00, 0x33};
+  assertTrue(frame.length() == 4 && memcmp(frame.data(), cobsOut, 4) == 0);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
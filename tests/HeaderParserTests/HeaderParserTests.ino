@@ -0,0 +1,104 @@
+#include <AUnit.h>
+#include "HeaderParser.h"
+
+static const char kRequest[] =
+  "POST /api/led?on=1&level=200 HTTP/1.1\r\n"
+  "Host: esp32.local\r\n"
+  "content-length:   12 \r\n"
+  "X-Empty:\r\n"
+  "Set-Cookie: a=1\r\n"
+  "Set-Cookie: b=2\r\n"
+  "\r\n"
+  "on=1&level=2";
+
+test(HeaderParser, requestAndHeaders) {
+  HeaderParser<8> http;
+  assertTrue(http.parseRequest(StringView(kRequest)));
+  assertTrue(http.method() == "POST");
+  assertTrue(http.path() == "/api/led");
+  assertTrue(http.query() == "on=1&level=200");
+  assertTrue(http.version() == "HTTP/1.1");
+  assertEqual((int)http.count(), 5);
+  assertTrue(http.name(1) == "content-length");
+  assertEqual(http.get("Content-Length").toLong(), 12L);
+  assertEqual(http.get(headerHash("CONTENT-LENGTH")).toLong(), 12L);
+  assertTrue(http.has("x-empty"));
+  assertTrue(http.get("X-Empty").isEmpty());
+  assertFalse(http.has("Accept"));
+
+  int first = http.indexOf("set-cookie");
+  assertEqual(first, 3);
+  assertTrue(http.value(http.indexOf("set-cookie", first + 1)) == "b=2");
+  assertTrue(StringView(StringView(kRequest).slice(http.bodyOffset())) == "on=1&level=2");
+
+  // The compile-time and run-time hashes agree.
+  static_assert(headerHash("Host") == view_detail::fnv1aFolded("host", 4), "");
+  assertTrue(headerHash(StringView("hOsT")) == headerHash("Host"));
+
+  // A char buffer hashes only its text, like StringView(buffer).
+  char nameBuf[16] = "Content-Length";
+  assertTrue(headerHash(nameBuf) == headerHash(StringView("content-length")));
+  assertEqual(http.get(headerHash(nameBuf)).toLong(), 12L);
+}
+
+test(HeaderParser, hashCollisionsAreRejected) {
+  // "x-jez3jwd" has the same folded FNV-1a hash as "content-length".
+  static const char kForged[] =
+    "GET / HTTP/1.1\r\n"
+    "X-Jez3jwd: 999999\r\n"
+    "Content-Length: 5\r\n"
+    "\r\n";
+  assertTrue(headerHash(StringView("x-jez3jwd")) == headerHash("Content-Length"));
+  HeaderParser<4> http;
+  assertTrue(http.parseRequest(StringView(kForged)));
+  assertEqual(http.get(headerHash("Content-Length")).toLong(), 5L);
+  assertEqual(http.indexOf(headerHash("content-length")), 1);
+  assertEqual(http.indexOf(headerHash("Content-Type")), -1);
+}
+
+test(HeaderParser, incompleteAndMalformed) {
+  HeaderParser<2> http;
+  assertFalse(http.parse(StringView("A: 1\nB: 2\nC: 3\n")));
+  assertFalse(http.isComplete());
+  assertTrue(http.isTruncated());
+  assertEqual((int)http.count(), 2);
+
+  assertTrue(http.parse(StringView("Bad line\r\n : x\r\nOk: y\r\n\r\n")));
+  assertTrue(http.isMalformed());
+  assertEqual((int)http.count(), 1);
+  assertTrue(http.get("ok") == "y");
+  assertFalse(http.parseRequest(StringView("GET\r\n\r\n")));
+  assertFalse(http.parseRequest(StringView("")));
+
+  assertTrue(StringView("Content-Type").equalsIgnoreCase("content-TYPE"));
+  assertFalse(StringView("Content-Type").equalsIgnoreCase("content-typ"));
+  assertTrue(StringView("multipart/form-data; b=1").startsWithIgnoreCase("Multipart/"));
+  assertFalse(StringView("[").equalsIgnoreCase("{"));
+}
+
+test(QueryString, pairs) {
+  QueryString q(StringView("?on=1&&level=200&flag&=x"));
+  StringView key, value;
+  assertTrue(q.next(key, value));
+  assertTrue(key == "on" && value == "1");
+  assertTrue(q.next(key, value));
+  assertTrue(key == "level" && value.toLong() == 200);
+  assertTrue(q.next(key, value));
+  assertTrue(key == "flag" && value.isEmpty());
+  assertTrue(q.next(key, value));
+  assertTrue(key.isEmpty() && value == "x");
+  assertFalse(q.next(key, value));
+
+  assertTrue(q.get("level") == "200");
+  assertTrue(q.has("flag"));
+  assertFalse(q.has("fla"));
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
@@ -0,0 +1,94 @@
+#include <AUnit.h>
+#include "JsonTokenizer.h"
+
+test(JsonTokenizer, pullTokens) {
+  JsonTokenizer json(StringView("{\"id\": 7, \"tags\": [\"a\", true, null], \"t\": -1.5e2}"));
+  assertTrue(json.next() == JsonToken::BeginObject);
+  assertTrue(json.next() == JsonToken::Key);
+  assertTrue(json.text() == "id");
+  assertTrue(json.next() == JsonToken::Number);
+  assertEqual(json.text().toLong(), 7L);
+  assertTrue(json.next() == JsonToken::Key);
+  assertTrue(json.next() == JsonToken::BeginArray);
+  assertEqual((int)json.depth(), 2);
+  assertTrue(json.next() == JsonToken::String);
+  assertTrue(json.text() == "a");
+  assertTrue(json.next() == JsonToken::True);
+  assertTrue(json.next() == JsonToken::Null);
+  assertTrue(json.next() == JsonToken::EndArray);
+  assertTrue(json.next() == JsonToken::Key);
+  assertTrue(json.next() == JsonToken::Number);
+  assertTrue(json.text() == "-1.5e2");
+  assertTrue(json.next() == JsonToken::EndObject);
+  assertTrue(json.next() == JsonToken::End);
+  assertTrue(json.ok());
+
+  JsonTokenizer bad(StringView("[1, 2}"));
+  while (bad.next() != JsonToken::End && bad.ok()) {}
+  assertFalse(bad.ok());
+  JsonTokenizer trailing(StringView("{\"a\":1,}"));
+  while (trailing.next() != JsonToken::End && trailing.ok()) {}
+  assertFalse(trailing.ok());
+
+  // Numbers follow the JSON grammar.
+  const char* const malformed[] = {"[1-2]", "[1..2]", "[1e+e]", "[01]", "[1.]", "[-]", "[.5]", "[1e]"};
+  for (size_t i = 0; i < sizeof(malformed) / sizeof(malformed[0]); i++) {
+    JsonTokenizer num{StringView(malformed[i])};
+    while (num.next() != JsonToken::End && num.ok()) {}
+    assertFalse(num.ok());
+  }
+  JsonTokenizer good(StringView("[0, -0.5, 2E+10, 1e-3]"));
+  while (good.next() != JsonToken::End && good.ok()) {}
+  assertTrue(good.ok());
+}
+
+test(JsonTokenizer, findPathSkipsSubtrees) {
+  const char* doc =
+    "{\"meta\": {\"note\": \"} [ \\\" ignored\"}, "
+    "\"sensors\": [{\"temp\": 20.5}, {\"id\": \"b\", \"temp\": 21.25, \"hum\": 40}], "
+    "\"after\": 1}";
+  JsonTokenizer json{StringView(doc)};
+  assertTrue(json.findPath("sensors[1].temp") == JsonToken::Number);
+  assertEqual(json.text().toFixed(2), 2125L);
+  // Stopped at the value: the rest of the document is still unread.
+  assertTrue(json.next() == JsonToken::Key);
+  assertTrue(json.text() == "hum");
+
+  JsonTokenizer again{StringView(doc)};
+  assertTrue(again.findPath("sensors[2]") == JsonToken::End);
+  assertTrue(again.ok());
+  JsonTokenizer missing{StringView(doc)};
+  assertTrue(missing.findPath("meta.nothing") == JsonToken::End);
+
+  JsonTokenizer nested{StringView(doc)};
+  assertTrue(nested.findPath("sensors") == JsonToken::BeginArray);
+  assertTrue(nested.next() == JsonToken::BeginObject);
+  assertTrue(nested.skip());
+  assertTrue(nested.next() == JsonToken::BeginObject);
+  assertTrue(nested.findPath("id") == JsonToken::String);
+  assertTrue(nested.text() == "b");
+}
+
+test(JsonTokenizer, unescapeOnDemand) {
+  JsonTokenizer json(StringView("[\"plain\", \"a\\\"b\\\\n\\u00e9\\ud83d\\ude00\"]"));
+  char buf[16];
+  json.next();
+  json.next();
+  assertFalse(json.hasEscapes());
+  StringView plain = json.unescaped(buf, sizeof(buf));
+  assertTrue(plain.data() != buf);
+  assertTrue(plain == "plain");
+
+  json.next();
+  assertTrue(json.hasEscapes());
+  assertTrue(json.unescaped(buf, sizeof(buf)) == "a\"b\\n\xC3\xA9\xF0\x9F\x98\x80");
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial);
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
@@ -0,0 +1,50 @@
+#include <AUnit.h>
+#include "KeywordMatcher.h"
+
+constexpr const char* kAtWords[] = {"OK", "ERROR", "RING", "NO CARRIER", "BUSY", "CONNECT"};
+typedef KeywordMatcher<6, kAtWords> AtResponse;
+
+constexpr const char* kNmeaIds[] = {
+  "GGA", "GLL", "GSA", "GSV", "RMC", "VTG", "ZDA", "GNS", "GST", "TXT", "DTM", "GBS"
+};
+typedef KeywordMatcher<12, kNmeaIds> NmeaSentence;
+
+constexpr const char* kOne[] = {"x"};
+typedef KeywordMatcher<1, kOne> Single;
+
+test(KeywordMatcher, atResponses) {
+  assertEqual(AtResponse::find("OK"), 0);
+  assertEqual(AtResponse::find("CONNECT"), 5);
+  assertEqual(AtResponse::find("NO CARRIER"), 3);
+  assertEqual(AtResponse::find("OK2"), -1);
+  assertEqual(AtResponse::find("ok"), -1);
+  assertEqual(AtResponse::find(""), -1);
+  assertEqual(AtResponse::find("A VERY LONG LINE THAT IS NO KEYWORD"), -1);
+
+  // Tokens are usually sub-views of a larger buffer.
+  StringView line("+CME: RING\r\n");
+  assertEqual(AtResponse::find(line.slice(6, 4)), 2);
+  assertTrue(AtResponse::contains(line.slice(6, 4)));
+  assertFalse(AtResponse::contains(line.slice(6, 3)));
+}
+
+test(KeywordMatcher, everyKeywordRoundTrips) {
+  for (size_t i = 0; i < NmeaSentence::size(); i++)
+    assertEqual(NmeaSentence::find(kNmeaIds[i]), (int)i);
+  assertEqual(NmeaSentence::find("GGB"), -1);
+  assertEqual(NmeaSentence::find("GG"), -1);
+  assertTrue(NmeaSentence::isPerfect());
+  assertTrue(AtResponse::isPerfect());
+
+  assertEqual(Single::find("x"), 0);
+  assertEqual(Single::find("y"), -1);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
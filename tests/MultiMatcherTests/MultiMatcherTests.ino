@@ -0,0 +1,72 @@
+#include <AUnit.h>
+#include "MultiMatcher.h"
+
+constexpr const char* kUrcs[] = {"OK", "ERROR", "+CME ERROR:", "RING", "NO CARRIER", "+CMTI:"};
+typedef MultiMatcher<6, kUrcs> UrcMatcher;
+
+constexpr const char* kOverlap[] = {"he", "she", "his", "hers"};
+typedef MultiMatcher<4, kOverlap> Overlap;
+
+test(MultiMatcher, findsFirstOccurrence) {
+  StringView reply("AT+CMGS\r\n+CME ERROR: 305\r\n");
+  MultiMatch m = UrcMatcher::find(reply);
+  assertTrue(m.found());
+  assertEqual(m.pattern, 1);                   // "ERROR" ends before "+CME ERROR:" does
+  assertEqual(m.start(), (size_t)14);
+  assertEqual(m.length, (size_t)5);
+
+  m = UrcMatcher::find(reply, m.end);
+  assertFalse(m.found());
+  assertTrue(UrcMatcher::containsAny("\r\nRING\r\n"));
+  assertFalse(UrcMatcher::containsAny("O K ERRO RIN"));
+  assertFalse(UrcMatcher::containsAny(""));
+  assertEqual(UrcMatcher::kWords, (size_t)2);
+}
+
+test(MultiMatcher, reportsEveryOverlap) {
+  Overlap m;
+  char seen[48];
+  size_t n = 0;
+  size_t count = m.scan(StringView("ushers"), [&](const MultiMatch& r) {
+    seen[n++] = (char)('0' + r.pattern);
+    seen[n++] = (char)('0' + r.start());
+  });
+  assertEqual(count, (size_t)3);               // he@2 and she@1 end together, then hers@2
+  assertEqual(StringView(seen, n), StringView("021132"));
+}
+
+test(MultiMatcher, matchesAcrossChunks) {
+  const char* chunks[] = {"+CM", "TI: \"SM\",3\r\nNO CAR", "RIER\r", "\nR", "I", "NG"};
+  UrcMatcher m;
+  int found[4];
+  size_t ends[4], n = 0;
+  for (size_t c = 0; c < 6; c++) {
+    m.scan(StringView(chunks[c]), [&](const MultiMatch& r) {
+      found[n] = r.pattern;
+      ends[n++] = r.end;
+    });
+  }
+  assertEqual(n, (size_t)3);
+  assertEqual(found[0], 5);
+  assertEqual(ends[0], (size_t)6);
+  assertEqual(found[1], 4);
+  assertEqual(ends[1], (size_t)25);
+  assertEqual(found[2], 3);
+  assertEqual(m.position(), (size_t)31);
+
+  // The same stream wrapped around a ring buffer.
+  char ring[16];
+  memcpy(ring, "CARRIER\r\n>>>NO ", 15);
+  m.reset();
+  assertEqual(m.scan(RingView<char>(MemoryView<char>(ring + 12, 3), MemoryView<char>(ring, 9)),
+                     [](const MultiMatch&) {}), (size_t)1);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
@@ -0,0 +1,77 @@
+#include <AUnit.h>
+#include "MutableView.h"
+
+struct Sample {
+  int16_t x, y;
+};
+
+test(MutableView, fillCopyAndConvert) {
+  int16_t data[7];
+  MutableView<int16_t> view(data);
+  view.fill(3);
+  MemoryView<int16_t> readOnly = view;
+  assertEqual((int)readOnly.length(), 7);
+  assertEqual(readOnly[6], (int16_t)3);
+
+  int16_t src[] = {1, 2, 3};
+  assertEqual((int)view.copyFrom(MemoryView<int16_t>(src), 5), 2);
+  assertEqual(data[5], (int16_t)1);
+  assertEqual(data[6], (int16_t)2);
+
+  view.copyFrom(readOnly.slice(4, 3), 3);  // overlapping move
+  assertEqual(data[3], (int16_t)3);
+  assertEqual(data[4], (int16_t)1);
+  assertEqual(data[5], (int16_t)2);
+
+  Sample frames[3];
+  Sample zero = {0, -1};
+  MutableView<Sample>(frames).fill(zero);
+  assertEqual(frames[2].y, (int16_t)-1);
+}
+
+test(MutableView, reverseAndReplace) {
+  char text[] = "0123456789abcdefghij";
+  MutableStringView s(text, 20);
+  s.reverse();
+  assertTrue(StringView(s).equals("jihgfedcba9876543210"));
+
+  s.slice(1, 3).reverse();
+  assertTrue(s.startsWith("jghi"));
+
+  char path[] = "a/b/c/dddddddddddd/e";
+  MutableStringView p(path, sizeof(path) - 1);
+  p.replaceAll('/', '.');
+  assertTrue(p.equals("a.b.c.dddddddddddd.e"));
+
+  int values[] = {1, 5, 1, 5};
+  MutableView<int>(values).replaceAll(5, 2);
+  assertEqual(values[1], 2);
+  assertEqual(values[3], 2);
+}
+
+test(MutableView, caseAndByteSwap) {
+  char header[] = "Content-Type: TEXT/Plain; Charset=UTF-8 \xC4";
+  MutableStringView h(header, sizeof(header) - 1);
+  h.toLowerInPlace();
+  assertTrue(h.equals("content-type: text/plain; charset=utf-8 \xC4"));
+  h.slice(0, 12).toUpperInPlace();
+  assertTrue(h.startsWith("CONTENT-TYPE:"));
+
+  uint16_t regs[] = {0x1234, 0xABCD};
+  MutableView<uint16_t>(regs).byteSwapInPlace();
+  assertEqual(regs[0], (uint16_t)0x3412);
+  assertEqual(regs[1], (uint16_t)0xCDAB);
+
+  uint32_t word[] = {0x11223344UL};
+  MutableView<uint32_t>(word).byteSwapInPlace();
+  assertEqual(word[0], (uint32_t)0x44332211UL);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
@@ -0,0 +1,82 @@
+#include <AUnit.h>
+#include "PatternMatcher.h"
+
+constexpr char kLogFiles[] = "log_20[0-9][0-9]-[01]?-*.txt";
+constexpr char kNotHidden[] = "[!.]*";
+constexpr char kErrorCode[] = "E[0-9][0-9][0-9]";
+constexpr char kEscaped[] = "\\*?";
+
+test(PatternMatcher, mqttTopics) {
+  assertTrue(topicMatches("sensors/+/temp", "sensors/kitchen/temp"));
+  assertFalse(topicMatches("sensors/+/temp", "sensors/kitchen/humidity"));
+  assertFalse(topicMatches("sensors/+/temp", "sensors/kitchen/temp/raw"));
+  assertTrue(topicMatches("sensors/#", "sensors/kitchen/temp"));
+  assertTrue(topicMatches("sensors/#", "sensors"));
+  assertFalse(topicMatches("sensors/#", "sensorsX"));
+  assertTrue(topicMatches("#", "a/b/c"));
+  assertTrue(topicMatches("+/+", "/finance"));
+  assertTrue(topicMatches("+", "finance"));
+  assertFalse(topicMatches("+", "a/b"));
+  assertFalse(topicMatches("#", "$SYS/uptime"));
+  assertTrue(topicMatches("$SYS/#", "$SYS/uptime"));
+  assertTrue(topicMatches("a/b", "a/b"));
+  assertFalse(topicMatches("a/b", "a/bc"));
+  assertFalse(topicMatches("a/b/", "a/b"));
+  assertTrue(topicMatches("a/b/", "a/b/"));
+  assertFalse(topicMatches("", "a"));
+}
+
+test(PatternMatcher, globs) {
+  assertTrue(globMatch("*.csv", "data.csv"));
+  assertFalse(globMatch("*.csv", "data.csv.bak"));
+  assertTrue(globMatch("*", ""));
+  assertFalse(globMatch("?", ""));
+  assertTrue(globMatch("a*b*c", "aXbYbZc"));
+  assertFalse(globMatch("a*b*c", "aXbYbZ"));
+  assertTrue(globMatch("**a**", "xxa"));
+  assertTrue(globMatch("[a-c]x[!0-9]", "bxq"));
+  assertFalse(globMatch("[a-c]x[!0-9]", "bx7"));
+  assertTrue(globMatch("[]]", "]"));
+  assertTrue(globMatch("[", "["));
+  assertTrue(globMatch("\\*", "*"));
+  assertFalse(globMatch("\\*", "a"));
+  // Near-miss input that makes backtracking matchers exponential.
+  assertFalse(globMatch("a*a*a*a*a*a*a*b", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"));
+
+  assertTrue(GlobMatcher<kLogFiles>::matches("log_2024-07-x.txt"));
+  assertTrue(GlobMatcher<kLogFiles>::matches("log_2024-12-.txt"));
+  assertFalse(GlobMatcher<kLogFiles>::matches("log_2024-27-x.txt"));
+  assertFalse(GlobMatcher<kLogFiles>::matches("log_2024-07-x.txt~"));
+  assertTrue(GlobMatcher<kNotHidden>::matches("notes"));
+  assertFalse(GlobMatcher<kNotHidden>::matches(".git"));
+  static const char* const names[] = {"log_2024-07-x.txt", "log_2024-12-.txt", "x", "", ".txt", "log_20a1-1b-.txt"};
+  for (size_t i = 0; i < 6; i++)
+    assertEqual(GlobMatcher<kLogFiles>::matches(names[i]), globMatch(kLogFiles, names[i]));
+}
+
+test(PatternMatcher, shiftOrSearch) {
+  StringView line("W: retry; E12 then E404 and E999");
+  StringView hit = ShiftOrMatcher<kErrorCode>::find(line);
+  assertTrue(hit == "E404");
+  assertEqual((size_t)(hit.data() - line.data()), (size_t)19);
+  assertTrue(ShiftOrMatcher<kErrorCode>::find(line, 20) == "E999");
+  assertTrue(ShiftOrMatcher<kErrorCode>::find("E12").data() == nullptr);
+  assertFalse(ShiftOrMatcher<kErrorCode>::contains("none here"));
+  assertEqual(ShiftOrMatcher<kErrorCode>::matchLength(), (size_t)4);
+  assertTrue(ShiftOrMatcher<kEscaped>::find("a*b") == "*b");
+
+  assertTrue(findPattern(kErrorCode, line) == "E404");
+  assertTrue(findPattern("a?a", "abxaya") == "aya");
+  assertTrue(findPattern("aab", "aaab") == "aab");
+  assertTrue(findPattern("x", "abc").data() == nullptr);
+  assertTrue(findPattern("", "abc").data() == nullptr);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
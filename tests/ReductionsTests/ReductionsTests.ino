@@ -0,0 +1,65 @@
+#include <AUnit.h>
+#include "Reductions.h"
+
+test(Reductions, integerWindows) {
+  static const int16_t window[] = {100, -200, 300, -400, 500, 32767, -32768};
+  MemoryView<int16_t> v(window);
+  assertEqual((long)sum(v), 300L - 1);
+  MinMax<int16_t> r = minMax(v);
+  assertEqual(r.min, (int16_t)-32768);
+  assertEqual((int)r.minIndex, 6);
+  assertEqual(r.max, (int16_t)32767);
+  assertEqual((int)r.maxIndex, 5);
+  assertEqual(countIf(v, [](int16_t s) { return s < 0; }), (size_t)3);
+
+  // Full-scale samples overflow 32-bit products sums; the accumulator is 64-bit.
+  static int16_t loud[4096];
+  for (size_t i = 0; i < 4096; i++) loud[i] = (i & 1) ? 32767 : -32768;
+  MemoryView<int16_t> l(loud);
+  int64_t energy = sumSquares(l);
+  assertTrue(energy == 2048LL * 32767 * 32767 + 2048LL * 32768 * 32768);
+  assertEqual((long)sum(l), -2048L);
+  assertTrue(dot(l, l.slice(1)) == -4095LL * 32767 * 32768);
+  assertTrue(fabs(rms(l) - 32767.5f) < 0.5f);
+
+  // int and long widen whichever of them int32_t is (long on newlib ARM and ESP-IDF 5).
+  static_assert(sizeof(view_detail::SumType<int>::type) == (sizeof(int) < 4 ? 4 : 8), "int sums widen");
+  static_assert(sizeof(view_detail::SumType<long>::type) == 8, "long sums widen");
+  static_assert(sizeof(view_detail::ProductType<long>::type) == 8, "long products widen");
+  static const long big[] = {2000000000L, 2000000000L};
+  assertTrue(sum(MemoryView<long>(big)) == 4000000000LL);
+  assertTrue(sumSquares(MemoryView<long>(big)) == 8000000000000000000LL);
+
+  static const uint8_t bytes[] = {255, 255, 255};
+  assertEqual((long)sum(MemoryView<uint8_t>(bytes)), 765L);
+  assertEqual(mean(MemoryView<uint8_t>(bytes)), 255.0f);
+}
+
+test(Reductions, floatsAndEmpty) {
+  static const float x[] = {1.5f, -2.0f, 4.0f, 0.5f, 2.0f};
+  MemoryView<float> v(x);
+  assertNear(sum(v), 6.0f, 1e-6f);
+  assertNear(mean(v), 1.2f, 1e-6f);
+  MemoryView<float> w(x + 1, 4);
+  assertNear(dot(v, w), 1.5f * -2.0f - 8.0f + 2.0f + 1.0f, 1e-6f);
+  assertNear(rms(v), sqrtf(26.5f / 5), 1e-5f);
+
+  MemoryView<float> empty;
+  assertEqual(sum(empty), 0.0f);
+  assertEqual(mean(empty), 0.0f);
+  assertEqual(rms(empty), 0.0f);
+  assertEqual(minMax(empty).max, 0.0f);
+
+  static const double d[] = {1.0, 2.0};
+  double m = mean(MemoryView<double>(d));
+  assertEqual(m, 1.5);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
@@ -0,0 +1,80 @@
+#include <AUnit.h>
+#include "RingView.h"
+#include "BufferWriter.h"
+
+// A 16-byte UART ring whose read position (12) is near the end, so
+// "+CSQ: 21,0\r\nOK" wraps after "+CSQ".
+static char ring[16];
+
+static RingStringView fillRing() {
+  const char* msg = "+CSQ: 21,0\r\nOK";
+  size_t start = 12;
+  for (size_t i = 0; msg[i]; i++) ring[(start + i) % sizeof(ring)] = msg[i];
+  return RingStringView(ring, sizeof(ring), start, strlen(msg));
+}
+
+test(RingView, segmentsAndIndexing) {
+  RingStringView rx = fillRing();
+  assertFalse(rx.isContiguous());
+  assertEqual((int)rx.first().length(), 4);
+  assertEqual((int)rx.second().length(), 10);
+  assertEqual((int)rx.length(), 14);
+  assertEqual(rx[3], 'Q');
+  assertEqual(rx[4], ':');
+  assertTrue(rx.startsWith("+CSQ: "));
+  assertFalse(rx.startsWith("+CSQ:  "));
+  assertTrue(rx.slice(2, 4) == "SQ: ");
+  assertTrue(rx.slice(6).startsWith("21,0"));
+  assertTrue(rx.slice(6, 2).isContiguous());
+
+  RingStringView flat(ring, sizeof(ring), 0, 4);
+  assertTrue(flat.isContiguous());
+}
+
+test(RingView, searchAcrossWrap) {
+  RingStringView rx = fillRing();
+  assertEqual(rx.indexOf(':'), 4);
+  assertEqual(rx.indexOf("SQ: 2"), 2);   // straddles the wrap
+  assertEqual(rx.indexOf("\r\nOK"), 10);  // entirely after the wrap
+  assertEqual(rx.indexOf("+C"), 0);       // entirely before the wrap
+  assertEqual(rx.indexOf("SQ: 2", 3), -1);
+  assertEqual(rx.indexOf("OKK"), -1);
+  assertTrue(rx.contains("Q:"));
+
+  uint8_t raw[8] = {5, 6, 7, 0, 1, 2, 3, 4};
+  RingView<uint8_t> bytes(raw, sizeof(raw), 3, 8);
+  uint8_t pat[] = {3, 4, 5, 6};
+  assertEqual(bytes.indexOf(MemoryView<uint8_t>(pat)), 3);
+  assertEqual(bytes.indexOf((uint8_t)7), 7);
+}
+
+test(RingView, tokenizeAndLinearize) {
+  RingStringView rx = fillRing();
+  size_t offset = 6;
+  RingStringView line = rx.nextToken("\r\n", offset);
+  size_t field = 0;
+  assertTrue(line.nextToken(',', field) == "21");
+  assertTrue(line.nextToken(',', field) == "0");
+  assertTrue(rx.nextToken("\r\n", offset) == "OK");
+  assertTrue(rx.nextToken("\r\n", offset).isEmpty());
+
+  char scratch[16];
+  StringView head = rx.slice(0, 8).linearize(scratch, sizeof(scratch));
+  assertTrue(head == "+CSQ: 21");
+  assertEqual(StringView(head.slice(6)).toLong(), 21L);
+  assertTrue(rx.slice(6, 2).linearize(nullptr, 0) == "21");  // contiguous: no copy
+  assertTrue(rx.linearize(scratch, 4).isEmpty());
+
+  StaticBufferWriter<20> out;
+  out.print(rx.slice(2, 6));
+  assertTrue(out.view() == "SQ: 21");
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
@@ -0,0 +1,82 @@
+#include <AUnit.h>
+#include "SortedView.h"
+
+struct Calibration {
+  int16_t raw;
+  int16_t milliVolts;
+};
+
+struct ByRaw {
+  bool operator()(const Calibration& c, int16_t raw) const { return c.raw < raw; }
+  bool operator()(int16_t raw, const Calibration& c) const { return raw < c.raw; }
+};
+
+static const Calibration kTable[] = {{0, 0}, {512, 1650}, {1023, 3300}, {2047, 3310}};
+
+test(MemoryView, binarySearches) {
+  static const uint8_t values[] = {1, 3, 3, 3, 7, 9};
+  MemoryView<uint8_t> v(values);
+  assertTrue(v.isSorted());
+  assertEqual((int)v.lowerBound(3), 1);
+  assertEqual((int)v.upperBound(3), 4);
+  assertEqual((int)v.lowerBound(0), 0);
+  assertEqual((int)v.lowerBound(10), 6);
+  assertEqual(v.binarySearch(7), 4);
+  assertEqual(v.binarySearch(4), -1);
+  assertEqual((int)v.equalRange(3).length(), 3);
+  assertTrue(v.equalRange(3).data() == values + 1);
+  assertTrue(v.equalRange(5).isEmpty());
+  assertEqual((int)MemoryView<uint8_t>().lowerBound(1), 0);
+
+  MemoryView<Calibration> table(kTable);
+  assertTrue(table.isSorted([](const Calibration& a, const Calibration& b) { return a.raw < b.raw; }));
+  size_t i = table.lowerBound((int16_t)600, ByRaw());
+  assertEqual((int)table[i].milliVolts, 3300);
+  assertEqual(table.binarySearch((int16_t)512, ByRaw()), 1);
+
+  static const uint8_t unsorted[] = {2, 1};
+  assertFalse(MemoryView<uint8_t>(unsorted).isSorted());
+}
+
+test(SortedView, lookups) {
+  static const uint16_t ids[] = {3, 17, 42, 42, 230, 1024};
+  SortedView<uint16_t> sorted(ids);
+  assertTrue(sorted.contains(42));
+  assertFalse(sorted.contains(43));
+  assertEqual(sorted.indexOf(230), 4);
+  assertEqual((int)sorted.equalRange(42).length(), 2);
+  assertEqual(sorted.slice(3).indexOf(230), 1);
+
+  SortedView<Calibration, ByRaw> cal(kTable);
+  assertEqual(cal.indexOf((int16_t)1023), 2);
+  assertEqual((int)cal.upperBound((int16_t)1023), 3);
+}
+
+test(EytzingerView, matchesLowerBound) {
+  uint16_t sorted[100], layout[100];
+  for (size_t i = 0; i < 100; i++) sorted[i] = (uint16_t)(i * 3);
+  for (size_t n = 0; n <= 100; n++) {
+    MemoryView<uint16_t> view(sorted, n);
+    EytzingerView<uint16_t> tree = EytzingerView<uint16_t>::build(view, layout);
+    for (uint16_t v = 0; v < 305; v++) {
+      size_t i = view.lowerBound(v);
+      const uint16_t* p = tree.lowerBound(v);
+      if (i == n) {
+        assertTrue(p == nullptr);
+      } else {
+        assertTrue(p != nullptr);
+        assertEqual(*p, sorted[i]);
+      }
+      assertEqual(tree.contains(v), view.binarySearch(v) != -1);
+    }
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
@@ -0,0 +1,91 @@
+#include <AUnit.h>
+#include "StaticStringMap.h"
+
+test(StaticStringMap, arenaKeys) {
+  static const char config[] = "ssid=home;pass=secret;port=1883;host=broker";
+  StringView text(config);
+  StaticStringMap<StringView, 8> settings;
+  size_t offset = 0;
+  while (offset < text.length()) {
+    StringView pair = text.nextToken(';', offset);
+    int eq = pair.indexOf('=');
+    assertTrue(settings.put(StringView(pair.data(), eq), StringView(pair.slice(eq + 1))));
+  }
+  assertEqual(settings.size(), (size_t)4);
+  assertTrue(settings.get("port") == "1883");
+  assertTrue(settings.get("host") == "broker");
+  assertTrue(settings.find("hos") == nullptr);
+  assertFalse(settings.contains("ssid="));
+  // Arena keys are the caller's views; no copies are made.
+  assertTrue(settings.keyOf("pass").data() == config + 10);
+  assertEqual(settings.poolUsed(), (size_t)0);
+
+  assertTrue(settings.put("port", "8883"));
+  assertEqual(settings.size(), (size_t)4);
+  assertTrue(settings.get("port") == "8883");
+  assertTrue(settings.remove("ssid"));
+  assertFalse(settings.remove("ssid"));
+  assertFalse(settings.contains("ssid"));
+  assertTrue(settings.get("pass") == "secret");
+}
+
+test(StaticStringMap, pooledKeysAndLimits) {
+  StaticStringMap<uint8_t, 3, 16> ids;
+  char rx[16];
+  strcpy(rx, "sensor-a");
+  assertTrue(ids.put(StringView(rx), 1));
+  strcpy(rx, "sensor-b");  // the receive buffer is reused
+  assertTrue(ids.put(StringView(rx), 2));
+  assertEqual(ids.get("sensor-a"), (uint8_t)1);
+  assertEqual(ids.get("sensor-b"), (uint8_t)2);
+  assertEqual(ids.poolUsed(), (size_t)16);
+  assertTrue(ids.findOrInsert("x") == nullptr);    // pool exhausted
+  assertTrue(ids.put("", 3));                       // empty keys take no bytes
+  assertTrue(ids.findOrInsert("", 9) != nullptr);
+  assertEqual(ids.get(""), (uint8_t)3);
+  ids.clear();
+  assertTrue(ids.isEmpty());
+  assertEqual(ids.poolUsed(), (size_t)0);
+  assertTrue(ids.put("a", 1) && ids.put("b", 2) && ids.put("c", 3));
+  assertFalse(ids.put("d", 4));                     // capacity reached
+  size_t total = 0;
+  ids.forEach([&](const StringView& key, uint8_t v) { total += (key.length() == 1) ? v : 100; });
+  assertEqual(total, (size_t)6);
+}
+
+test(StaticStringMap, collisionsSurviveRemoval) {
+  // Every key is inserted, then every other one removed: the rest must stay
+  // reachable after backward shifting.
+  static char names[40][4];
+  StaticStringMap<int, 40> map;
+  for (int i = 0; i < 40; i++) {
+    names[i][0] = 'k';
+    names[i][1] = (char)('0' + i / 10);
+    names[i][2] = (char)('0' + i % 10);
+    assertTrue(map.put(names[i], i));
+  }
+  assertEqual(map.size(), (size_t)40);
+  for (int i = 0; i < 40; i += 2) assertTrue(map.remove(names[i]));
+  for (int i = 0; i < 40; i++) {
+    const int* v = map.find(names[i]);
+    if (i % 2) {
+      assertTrue(v != nullptr);
+      assertEqual(*v, i);
+    } else {
+      assertTrue(v == nullptr);
+    }
+  }
+  int* counter = map.findOrInsert("k00", 0);
+  assertTrue(counter != nullptr);
+  ++*counter;
+  assertEqual(map.get("k00"), 1);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
@@ -0,0 +1,83 @@
+#include <AUnit.h>
+#include "StridedView.h"
+
+test(StridedView, channels) {
+  // Stereo frames: L R L R ...
+  static const int16_t samples[] = {1, -1, 2, -2, 3, -3, 4, -4, 5};
+  StridedView<int16_t> left = StridedView<int16_t>::channel(samples, 0, 2);
+  StridedView<int16_t> right = StridedView<int16_t>::channel(samples, 1, 2);
+  assertEqual((int)left.length(), 5);
+  assertEqual((int)right.length(), 4);
+  assertEqual(left[4], (int16_t)5);
+  assertEqual(right[3], (int16_t)-4);
+  assertTrue(StridedView<int16_t>::channel(samples, 2, 2).isEmpty());
+
+  int sum = 0;
+  for (int16_t s : right) sum += s;
+  assertEqual(sum, -10);
+
+  assertEqual(left.indexOf(3), 2);
+  assertFalse(left.contains(-3));
+  StridedView<int16_t> tail = left.slice(1, 3);
+  assertEqual(tail[0], (int16_t)2);
+  assertEqual((int)tail.length(), 3);
+  StridedView<int16_t> odd = left.step(2);
+  assertEqual((int)odd.length(), 3);
+  assertEqual(odd[2], (int16_t)5);
+
+  int16_t out[8];
+  assertEqual((int)right.copyTo(out, 8), 4);
+  assertEqual(out[1], (int16_t)-2);
+  assertFalse(left.isContiguous());
+  assertTrue(StridedView<int16_t>(MemoryView<int16_t>(samples)).asMemoryView().length() == 9);
+}
+
+test(StridedView, castFromBytes) {
+  // 4-byte records: uint8 id, uint8 flags, int16 value (host byte order).
+  alignas(int16_t) uint8_t dma[12];   // castTo<int16_t>() needs dma + 2 aligned for int16_t
+  for (uint8_t i = 0; i < 3; i++) {
+    int16_t value = (int16_t)(i * 100 - 50);
+    dma[i * 4] = i;
+    dma[i * 4 + 1] = 0;
+    memcpy(dma + i * 4 + 2, &value, 2);
+  }
+  StridedView<uint8_t> ids(dma, 3, 4);
+  assertEqual(ids[2], (uint8_t)2);
+  StridedView<int16_t> values = StridedView<uint8_t>(dma + 2, 3, 4).castTo<int16_t>();
+  assertEqual((int)values.stride(), 2);
+  assertEqual(values[0], (int16_t)-50);
+  assertEqual(values[2], (int16_t)150);
+  assertTrue(StridedView<uint8_t>(dma, 4, 3).castTo<int16_t>().isEmpty());  // odd byte stride
+}
+
+test(MatrixView, rowsAndColumns) {
+  static const uint16_t adc[] = {10, 11, 12, 13,
+                                 20, 21, 22, 23,
+                                 30, 31, 32, 33};
+  MatrixView<uint16_t> frames(MemoryView<uint16_t>(adc), 4);
+  assertEqual((int)frames.rows(), 3);
+  assertEqual(frames(1, 2), (uint16_t)22);
+  assertTrue(frames.row(2).data() == adc + 8);
+  assertTrue(frames.row(3).isEmpty());
+  StridedView<uint16_t> ch1 = frames.col(1);
+  assertEqual((int)ch1.length(), 3);
+  assertEqual(ch1[2], (uint16_t)31);
+
+  MatrixView<uint16_t> inner = frames.slice(1, 1, 2, 2);
+  assertEqual((int)inner.rowStride(), 4);
+  assertEqual(inner(0, 0), (uint16_t)21);
+  assertEqual(inner(1, 1), (uint16_t)32);
+  assertEqual(inner.col(1)[1], (uint16_t)32);
+  assertTrue(inner.asMemoryView().isEmpty());
+  assertEqual((int)frames.rowsFrom(2).rows(), 1);
+  assertEqual((int)frames.asMemoryView().length(), 12);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
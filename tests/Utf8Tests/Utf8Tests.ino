@@ -0,0 +1,58 @@
+#include <AUnit.h>
+#include "Utf8.h"
+
+test(Utf8, validation) {
+  assertTrue(isValidUtf8("plain ASCII label"));
+  assertTrue(isValidUtf8("Caf\xC3\xA9 \xE2\x82\xAC" "5 \xF0\x9F\x98\x80"));
+  assertTrue(isValidUtf8(""));
+  assertFalse(isValidUtf8("\xC0\xAF"));              // overlong '/'
+  assertFalse(isValidUtf8("\xED\xA0\x80"));          // surrogate
+  assertFalse(isValidUtf8("\xF4\x90\x80\x80"));      // above U+10FFFF
+  assertFalse(isValidUtf8("abc\x80"));
+
+  // A sequence cut at the end of a chunk is left for the next one.
+  StringView chunk("temp 21\xC2\xB0" "C \xE2\x82");
+  assertEqual(utf8ValidPrefix(chunk), (size_t)11);
+}
+
+test(Utf8, countsAndSlicesByCodePoint) {
+  Utf8View label(StringView("K\xC3\xB6ln \xE2\x86\x92 M\xC3\xBCnchen"));   // "Köln → München"
+  assertEqual(label.byteLength(), (size_t)18);
+  assertEqual(label.length(), (size_t)14);
+  assertFalse(label.isAscii());
+  assertTrue(label.isValid());
+  assertEqual(label.offsetOf(2), (size_t)3);
+  assertEqual(label.codePointAt(5), (uint32_t)0x2192);
+
+  assertEqual(label.left(2).bytes(), StringView("K\xC3\xB6"));
+  assertEqual(label.slice(7).bytes(), StringView("M\xC3\xBCnchen"));
+  assertEqual(label.right(6).length(), (size_t)6);
+  assertEqual(label.truncateBytes(8).bytes(), StringView("K\xC3\xB6ln "));   // not inside the arrow
+
+  Utf8View ascii(StringView("  status: ok \r\n"));
+  assertTrue(ascii.isAscii());
+  assertEqual(ascii.trim().bytes(), StringView("status: ok"));
+  assertEqual(ascii.slice(2, 6).bytes(), StringView("status"));
+}
+
+test(Utf8, iteratesWithReplacement) {
+  Utf8View text(StringView("a\xE2\x82\xAC\xFF" "b\xE2\x82"));
+  uint32_t expected[] = {'a', 0x20AC, 0xFFFD, 'b', 0xFFFD};
+  size_t i = 0;
+  for (uint32_t cp : text) {
+    assertLess(i, (size_t)5);
+    assertEqual(cp, expected[i++]);
+  }
+  assertEqual(i, (size_t)5);
+  assertEqual(text.length(), (size_t)5);
+  assertFalse(text.isValid());
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
@@ -0,0 +1,69 @@
+#include <AUnit.h>
+#include "ViewArena.h"
+
+test(ViewArena, copiesOutliveTheSource) {
+  ViewArena<32> arena;
+  char rx[16];
+  strcpy(rx, "dev-42,on");
+  StringView id = arena.copy(StringView(rx, 6));
+  strcpy(rx, "xxxxxxxxx");  // the receive buffer is reused
+  assertTrue(id == "dev-42");
+  assertEqual(arena.used(), (size_t)6);
+
+  const char* name = arena.copyCString("temp");
+  assertEqual(strcmp(name, "temp"), 0);
+  assertEqual(arena.used(), (size_t)11);
+
+  static const uint16_t samples[] = {1, 2, 3};
+  MemoryView<uint16_t> copy = arena.copy(MemoryView<uint16_t>(samples));
+  assertEqual(copy.length(), (size_t)3);
+  assertEqual((uintptr_t)copy.data() % alignof(uint16_t), (uintptr_t)0);
+  assertTrue(copy.data() != samples);
+  assertEqual(copy[2], (uint16_t)3);
+  assertFalse(arena.overflowed());
+
+  assertTrue(arena.copy("this will not fit in what is left").isEmpty());
+  assertTrue(arena.overflowed());
+  assertTrue(id == "dev-42");  // failed copies leave earlier ones alone
+  arena.reset();
+  assertEqual(arena.used(), (size_t)0);
+  assertFalse(arena.overflowed());
+}
+
+test(ViewArena, markRollbackAndScope) {
+  ViewArena<64> arena;
+  StringView keep = arena.copy("keep");
+  size_t m = arena.mark();
+  arena.copy("scratch");
+  int32_t* tmp = arena.allocate<int32_t>(4);
+  assertTrue(tmp != nullptr);
+  assertEqual((uintptr_t)tmp % alignof(int32_t), (uintptr_t)0);
+  arena.rollback(m);
+  assertEqual(arena.used(), (size_t)4);
+  assertTrue(keep == "keep");
+
+  {
+    ArenaScope scope(arena);
+    arena.copy("temporary");
+    assertEqual(arena.used(), (size_t)13);
+  }
+  assertEqual(arena.used(), (size_t)4);
+  {
+    ArenaScope scope(arena);
+    arena.copy("kept");
+    scope.commit();
+  }
+  assertEqual(arena.used(), (size_t)8);
+  assertTrue(arena.allocate<uint8_t>(57) == nullptr);
+  assertTrue(arena.allocate<uint8_t>(56) != nullptr);
+  assertEqual(arena.remaining(), (size_t)0);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
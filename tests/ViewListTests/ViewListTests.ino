@@ -0,0 +1,96 @@
+#include <AUnit.h>
+#include "ViewList.h"
+
+/** @brief Records every write() call so the tests can count them. */
+class CapturePrint : public Print {
+public:
+  CapturePrint() : writes(0), length(0), limit(sizeof(buffer)) {}
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* data, size_t n) override {
+    writes++;
+    if (n > limit - length) n = limit - length;
+    memcpy(buffer + length, data, n);
+    length += n;
+    return n;
+  }
+  StringView text() const { return StringView(buffer, length); }
+
+  char buffer[256];
+  size_t writes;
+  size_t length;
+  size_t limit;
+};
+
+test(ViewList, collectsWithoutCopying) {
+  char value[] = "23.5";
+  const uint8_t raw[] = {0x01, 0x02};
+  ViewList<4> list;
+  list.add("temp=").add(StringView(value)).add("").add(MemoryView<uint8_t>(raw, 2));
+  assertEqual(list.size(), (size_t)3);             // the empty fragment takes no slot
+  assertEqual(list.byteLength(), (size_t)11);
+  value[0] = '1';                                  // fragments still point at the caller's memory
+  assertEqual(list[1][0], (uint8_t)'1');
+
+  list.add("a").add("b");
+  assertTrue(list.overflowed());
+  assertEqual(list.size(), (size_t)4);
+
+  uint8_t out[8];
+  assertEqual(list.copyTo(out, sizeof(out)), (size_t)8);
+  assertEqual(StringView(reinterpret_cast<const char*>(out), 8), StringView("temp=13."));
+
+  list.clear();
+  assertTrue(list.isEmpty());
+  assertFalse(list.overflowed());
+}
+
+test(ViewList, coalescesSmallFragments) {
+  ViewList<8> list;
+  list.add("HTTP/1.1 200 OK\r\n").add("Content-Length: ").add("2").add("\r\n\r\n").add("OK");
+  CapturePrint out;
+  assertEqual(list.writeTo(out), list.byteLength());
+  assertEqual(out.writes, (size_t)1);
+  assertEqual(out.text(), StringView("HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nOK"));
+
+  // A fragment as large as the stage goes out directly, between two flushes.
+  uint8_t stage[8];
+  CapturePrint split;
+  ViewList<3> body;
+  body.add("ab").add("0123456789").add("cd");
+  assertEqual(body.writeTo(split, stage, sizeof(stage)), (size_t)14);
+  assertEqual(split.writes, (size_t)3);
+  assertEqual(split.text(), StringView("ab0123456789cd"));
+
+  CapturePrint printed;
+  printed.print(body);
+  assertEqual(printed.writes, (size_t)1);
+}
+
+struct TestIovec {
+  void* iov_base;
+  size_t iov_len;
+};
+
+test(ViewList, shortWritesAndIovecs) {
+  ViewList<3> list;
+  list.add("abc").add("defgh").add("ij");
+  CapturePrint full;
+  full.limit = 4;
+  uint8_t stage[4];
+  assertEqual(list.writeTo(full, stage, sizeof(stage)), (size_t)4);   // stops once the sink is full
+  assertEqual(full.text(), StringView("abcd"));
+
+  TestIovec iov[2];
+  assertEqual(list.toIovec(iov, 2), (size_t)2);
+  assertEqual(iov[1].iov_len, (size_t)5);
+  assertEqual(*static_cast<const char*>(iov[1].iov_base), 'd');
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial); // Wait for Serial on some boards
+}
+
+void loop() {
+  aunit::TestRunner::run();
+}
@@ -24,6 +24,61 @@ test(MemoryView, indexOfAndContains) {
   assertFalse(view.contains('z'));
 }
 
+test(MemoryView, wordScanAndLastIndexOf) {
+  uint8_t frame[40];
+  memset(frame, 0x55, sizeof(frame));
+  frame[3] = 0x7E;
+  frame[29] = 0x7E;
+  MemoryView<uint8_t> view = MemoryView<uint8_t>(frame).slice(1);
+
+  assertEqual(view.indexOf((uint8_t)0x7E), 2);
+  assertEqual(view.indexOf((uint8_t)0x7E, 3), 28);
+  assertEqual(view.indexOf((uint8_t)0x00), -1);
+  assertEqual(view.lastIndexOf((uint8_t)0x7E), 28);
+  assertEqual(view.lastIndexOf((uint8_t)0x7E, 27), 2);
+  assertEqual(view.lastIndexOf((uint8_t)0x7E, 1), -1);
+
+  StringView path = "/api/v1/status";
+  assertEqual(path.lastIndexOf('/'), 7);
+}
+
+test(MemoryView, patternSearch) {
+  StringView http = "GET / HTTP/1.1\r\nHost: a\r\n\r\nbody";
+  assertEqual(http.indexOf("\r\n\r\n"), 23);
+  assertEqual(http.indexOf("\r\n", 15), 23);
+  assertEqual(http.indexOf("\r\n", 24), 25);
+  assertEqual(http.indexOf("missing"), -1);
+  assertEqual(http.indexOf("body", 40), -1);
+
+  int samples[] = {1, 2, 3, 1, 2, 4};
+  int needle[] = {1, 2, 4};
+  MemoryView<int> view(samples);
+  assertEqual(view.indexOf(MemoryView<int>(needle)), 3);
+}
+
+test(MemoryView, searcherStrategies) {
+  char buf[300];
+  memset(buf, 'a', sizeof(buf));
+  memcpy(buf + 280, "aaab-boundary", 13);
+  StringView hay(buf, sizeof(buf));
+  StringView pattern = "aab-boundary";
+
+  Searcher<char> autoSearch(pattern);
+  Searcher<char> firstByte(pattern, SearchStrategy::FirstByte);
+  Searcher<char> naive(pattern, SearchStrategy::Naive);
+  assertEqual(hay.indexOf(pattern), 281);
+  assertEqual(autoSearch.find(hay), 281);
+  assertEqual(firstByte.find(hay), 281);
+  assertEqual(naive.find(hay), 281);
+  assertEqual(autoSearch.find(hay, 282), -1);
+
+  size_t offset = 0;
+  Searcher<char> crlf(StringView("\r\n"));
+  StringView lines = "one\r\ntwo";
+  assertTrue(lines.nextToken(crlf, offset).equals("one"));
+  assertTrue(lines.nextToken(crlf, offset).equals("two"));
+}
+
 // --- StringView Tests ---
 
 test(StringView, trimming) {
@@ -49,6 +104,54 @@ test(StringView, tokenization) {
   assertEqual(offset, (size_t)14);
 }
 
+test(StringView, splitRange) {
+  StringView csv = "a,b,,c";
+  const char* expected[] = {"a", "b", "", "c"};
+  int count = 0;
+  for (StringView token : csv.split(',')) {
+    assertTrue(token.equals(expected[count]));
+    count++;
+  }
+  assertEqual(count, 4);
+
+  count = 0;
+  for (StringView token : csv.split(',', true)) {
+    (void)token;
+    count++;
+  }
+  assertEqual(count, 3);
+
+  SplitRange pair = StringView("k=v=w").split('=', false, 1);
+  SplitRange::iterator capped = pair.begin();
+  assertTrue(capped->equals("k"));
+  ++capped;
+  assertTrue(capped->equals("v=w"));
+
+  int empty = 0;
+  for (StringView token : StringView("").split(',')) {
+    (void)token;
+    empty++;
+  }
+  assertEqual(empty, 0);
+}
+
+test(StringView, delimiterSet) {
+  const DelimiterSet delims(",; \t");
+  StringView line = "x;y, z\t;w";
+  const char* expected[] = {"x", "y", "z", "w"};
+  int count = 0;
+  for (StringView token : line.split(delims, true)) {
+    assertTrue(token.equals(expected[count]));
+    count++;
+  }
+  assertEqual(count, 4);
+  assertEqual(line.indexOfAny(delims, 2), 3);
+
+  size_t offset = 0;
+  assertTrue(line.nextToken(delims, offset).equals("x"));
+  assertEqual(offset, (size_t)2);
+}
+
 test(StringView, numericConversion) {
   StringView vLong = "123456";
   StringView vFloat = "3.14";
@@ -57,6 +160,153 @@ test(StringView, numericConversion) {
   assertNear(vFloat.toFloat(), 3.14f, 0.01f);
 }
 
+test(StringView, inPlaceParsing) {
+  ParseResult<long> r = StringView("-1234,5").parseInt<long>();
+  assertTrue(r.ok());
+  assertEqual(r.value, -1234L);
+  assertEqual((int)r.consumed, 5);
+
+  assertTrue(StringView("x1").parseInt<long>().status == ParseStatus::NoDigits);
+  assertTrue(StringView("-").parseInt<long>().status == ParseStatus::NoDigits);
+
+  ParseResult<int16_t> small = StringView("40000").parseInt<int16_t>();
+  assertTrue(small.status == ParseStatus::Overflow);
+  assertEqual(small.value, (int16_t)32767);
+  assertEqual(StringView("-32768").parseInt<int16_t>().value, (int16_t)-32768);
+
+  assertEqual(StringView("4294967295").parseUnsigned<uint32_t>().value, (uint32_t)4294967295UL);
+  assertTrue(StringView("4294967296").parseUnsigned<uint32_t>().status == ParseStatus::Overflow);
+
+  ParseResult<uint32_t> hex = StringView("0x1Fz").parseHex();
+  assertEqual(hex.value, (uint32_t)0x1F);
+  assertEqual((int)hex.consumed, 4);
+  assertEqual(StringView("ff").parseHex<uint8_t>().value, (uint8_t)0xFF);
+
+  ParseResult<int32_t> fixed = StringView("-21.5678C").parseFixedPoint(3);
+  assertEqual(fixed.value, (int32_t)-21567);
+  assertEqual((int)fixed.consumed, 8);
+  assertEqual(StringView("7").parseFixedPoint(2).value, (int32_t)700);
+  assertEqual(StringView(".25").parseFixedPoint(2).value, (int32_t)25);
+
+  ParseResult<float> f = StringView("12.5e-1,").parseFloat();
+  assertNear(f.value, 1.25f, 0.0001f);
+  assertEqual((int)f.consumed, 7);
+  assertEqual((int)StringView("2e").parseFloat().consumed, 1);
+  assertNear(StringView("-0.0003").parseFloat<double>().value, -0.0003, 1e-9);
+
+  char unterminated[4] = {'4', '2', '.', '5'};
+  assertNear(StringView(unterminated, 2).toDouble(), 42.0, 1e-9);
+  assertEqual(StringView("  -17 ").toLong(), -17L);
+}
+
+test(StringView, fixedAndFloatFastPath) {
+  assertEqual(StringView("4807.038").parseFixedPoint(3).value, (int32_t)4807038);
+  assertEqual(StringView("1.5e2").parseFixedPoint(0).value, (int32_t)150);
+  assertEqual(StringView("25e-3").parseFixedPoint(3).value, (int32_t)25);
+  assertEqual(StringView("-2.5678").parseFixedPoint(2, true).value, (int32_t)-257);
+  assertEqual(StringView(" 21.4996").toFixed(3), (int32_t)21500);
+  assertTrue(StringView("3000000").parseFixedPoint(3).status == ParseStatus::Overflow);
+  // Rounding sees digits beyond what the 32-bit mantissa keeps.
+  assertEqual(StringView("488888.28888").parseFixedPoint(3, true).value, (int32_t)488888289);
+  assertTrue(StringView("2147483.6475").parseFixedPoint(3, true).status == ParseStatus::Overflow);
+
+  assertEqual(StringView("0.1").parseFloat<float>().value, 0.1f);
+  assertEqual(StringView("-123.456").parseFloat<float>().value, -123.456f);
+  assertEqual(StringView("1e-5").parseFloat<float>().value, 1e-5f);
+  assertNear(StringView("6.02214e23").parseFloat<float>().value, 6.02214e23f, 1e18f);
+  assertTrue(StringView("1e999").parseFloat<float>().status == ParseStatus::Overflow);
+}
+
+#if VIEWS_CONSTEXPR_STRINGVIEW
+static constexpr StringView kCommands[] = {"ON"_sv, "OFF"_sv, "STATUS"_sv};
+static_assert(kCommands[2].length() == 6, "literal length is known at compile time");
+static_assert(StringView("a\0b").length() == 1, "length stops at the first NUL");
+#else
+static const StringView kCommands[] = {"ON"_sv, "OFF"_sv, "STATUS"_sv};
+#endif
+
+#define TEXT_100 "0123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789"
+// Longer than the default -fconstexpr-depth: cstrnlen must not recurse per character.
+static constexpr char kLongText[] = TEXT_100 TEXT_100 TEXT_100 TEXT_100 TEXT_100
+                                    TEXT_100 TEXT_100 TEXT_100 TEXT_100 TEXT_100;
+static_assert(view_detail::cstrnlen(kLongText, sizeof(kLongText)) == 1000, "cstrnlen: log-depth recursion");
+
+test(StringView, literalsAndArrays) {
+  StringView token = StringView("STATUS?").slice(0, 6);
+  assertTrue(token == kCommands[2]);
+  assertTrue(token == "STATUS");
+  assertTrue("STATUS" == token);
+  assertFalse(token == "STATUS?");
+  assertFalse(token == "STAT");
+
+  char buf[16] = "abc";
+  StringView fromBuf = buf;
+  assertEqual((int)fromBuf.length(), 3);
+  assertTrue(fromBuf == buf);
+
+  const char* ptr = buf;
+  assertTrue(StringView(ptr) == ptr);
+  assertTrue(ptr == fromBuf);
+
+  char raw[3] = {'a', 'b', 'c'};  // not terminated
+  assertEqual((int)StringView(raw).length(), 3);
+  assertTrue(fromBuf == raw);
+  assertTrue(StringView(nullptr).isEmpty());
+
+  char reply[] = {'O', 'K', '\0'};
+  assertFalse(StringView(reply, 3) == "OK");       // the view holds the NUL, the literal does not
+  assertTrue(StringView(reply, 2) == "OK");
+  assertEqual(view_detail::cstrnlen(kLongText, sizeof(kLongText)), (size_t)1000);
+
+  // F() operands need no extra include.
+  assertTrue(token.contains(F("TUS")));
+  assertTrue(token == F("STATUS"));
+}
+
+test(StringView, caseAndOrdering) {
+  StringView file("Firmware-V2.BIN");
+  assertTrue(file.endsWith(".BIN"));
+  assertFalse(file.endsWith(".bin"));
+  assertTrue(file.endsWithIgnoreCase(".bin"));
+  assertEqual(file.indexOfIgnoreCase("v2"), 9);
+  assertEqual(file.indexOfIgnoreCase("V2", 10), -1);
+  assertTrue(file.containsIgnoreCase("FIRMWARE"));
+  assertFalse(file.containsIgnoreCase("firmware-v3"));
+
+  assertTrue(StringView("abc").compare("abd") < 0);
+  assertTrue(StringView("abd").compare("abc") > 0);
+  assertTrue(StringView("ab").compare("abc") < 0);
+  assertEqual(StringView("abc").compare("abc"), 0);
+  assertTrue(StringView("\xF0").compare("a") > 0);  // bytes compare unsigned
+  assertTrue(StringView("Apple") < StringView("apple"));
+  assertEqual(StringView("WiFi.SSID").compareIgnoreCase("wifi.ssid"), 0);
+  assertTrue(StringView("wifi.Pass").compareIgnoreCase("WIFI.SSID") < 0);
+  assertTrue(StringView("B").compareIgnoreCase("a") > 0);
+}
+
+test(StringView, foldedWordsMatchBytes) {
+  // Every length and alignment through the word and tail loops.
+  char a[40], b[40];
+  for (size_t i = 0; i < sizeof(a); i++) a[i] = (char)("aZ_@[`{~9"[i % 9]);
+  for (size_t off = 0; off < 8; off++) {
+    for (size_t n = 0; n + off <= 32; n++) {
+      for (size_t i = 0; i < n; i++) {
+        char c = a[off + i];
+        b[i] = (c >= 'a' && c <= 'z') ? (char)(c - 32) : (c >= 'A' && c <= 'Z') ? (char)(c + 32) : c;
+      }
+      StringView x(a + off, n), y(b, n);
+      assertTrue(x.equalsIgnoreCase(y));
+      if (n == 0) continue;
+      b[n - 1] = (a[off + n - 1] == '[') ? '{' : '[';  // '[' and '{' differ only in 0x20
+      assertFalse(x.equalsIgnoreCase(y));
+      assertEqual(x.indexOfIgnoreCase(y), -1);
+      if (n == 1) continue;
+      int at = StringView(a, off + n).indexOfIgnoreCase(StringView(b, n - 1));
+      assertTrue(at != -1 && at <= (int)off);
+    }
+  }
+}
+
 void setup() {
   Serial.begin(115200);
   while (!Serial); // Wait for Serial on some boards